@@ -13,6 +13,8 @@
 #include "caf/log/test.hpp"
 #include "caf/scoped_actor.hpp"
 
+#include <vector>
+
 using namespace caf;
 
 namespace {
@@ -60,4 +62,24 @@ TEST("serialization roundtrips go through the registry") {
   dispatch_messages();
 }
 
+TEST("the registry drops actors from all shards after they terminate") {
+  std::vector<actor> hdls;
+  for (int i = 0; i < 200; ++i) {
+    auto hdl = sys.spawn(dummy);
+    sys.registry().put(hdl->id(), hdl);
+    hdls.push_back(std::move(hdl));
+  }
+  for (auto& hdl : hdls)
+    check_eq(sys.registry().get<actor>(hdl->id()), hdl);
+  std::vector<actor_id> ids;
+  for (auto& hdl : hdls) {
+    ids.push_back(hdl->id());
+    anon_send_exit(hdl, exit_reason::user_shutdown);
+  }
+  hdls.clear();
+  dispatch_messages();
+  for (auto id : ids)
+    check(sys.registry().get(id) == nullptr);
+}
+
 } // WITH_FIXTURE(test::fixture::deterministic)
@@ -9,6 +9,7 @@
 #include "caf/actor_factory.hpp"
 #include "caf/actor_registry.hpp"
 #include "caf/actor_system_config.hpp"
+#include "caf/config.hpp"
 #include "caf/defaults.hpp"
 #include "caf/detail/actor_system_access.hpp"
 #include "caf/detail/actor_system_config_access.hpp"
@@ -85,24 +86,37 @@ constexpr std::array<double, 9> default_buckets{{
 
 /// Metrics that the actor system collects.
 struct base_metrics_t {
-  explicit base_metrics_t(telemetry::metric_registry& reg) {
+  base_metrics_t(telemetry::metric_registry& reg,
+                 const actor_system_config& cfg) {
     rejected_messages = reg.counter_singleton("caf.system", "rejected-messages",
                                               "Number of rejected messages.");
     queued_messages = reg.gauge_singleton(
       "caf.system", "queued-messages", "Number of messages in all mailboxes.");
     running_count = reg.gauge_family("caf.system", "running-actors", {"name"},
                                      "Number of currently running actors.");
-    processed_messages = reg.counter_family("caf.actor", "processed-messages",
-                                            {"name"},
-                                            "Number of processed messages.");
+    if (get_or(cfg, "caf.metrics.shard-actor-metrics", false)) {
+      sharded_processed_messages = reg.sharded_counter_family(
+        "caf.actor", "processed-messages", {"name"},
+        "Number of processed messages.");
+      sharded_mailbox_size = reg.sharded_gauge_family(
+        "caf.actor", "mailbox-size", {"name"},
+        "Number of messages in the mailbox.");
+    } else {
+      processed_messages = reg.counter_family(
+        "caf.actor", "processed-messages", {"name"},
+        "Number of processed messages.");
+      mailbox_size = reg.gauge_family("caf.actor", "mailbox-size", {"name"},
+                                      "Number of messages in the mailbox.");
+    }
     processing_time = reg.histogram_family<double>(
       "caf.actor", "processing-time", {"name"}, default_buckets,
       "Time an actor needs to process messages.", "seconds");
     mailbox_time = reg.histogram_family<double>(
       "caf.actor", "mailbox-time", {"name"}, default_buckets,
       "Time a message waits in the mailbox before processing.", "seconds");
-    mailbox_size = reg.gauge_family("caf.actor", "mailbox-size", {"name"},
-                                    "Number of messages in the mailbox.");
+    pending_requests = reg.gauge_family(
+      "caf.actor", "pending-requests", {"name"},
+      "Number of requests that wait for a response.");
   }
 
   /// Counts the number of messages that were rejected because the target
@@ -116,7 +130,10 @@ struct base_metrics_t {
   telemetry::int_gauge_family* running_count;
 
   /// Counts the total number of processed messages by actor type.
-  telemetry::int_counter_family* processed_messages;
+  telemetry::int_counter_family* processed_messages = nullptr;
+
+  /// Replaces `processed_messages` when sharding actor metrics.
+  telemetry::sharded_int_counter_family* sharded_processed_messages = nullptr;
 
   /// Samples how long the actor needs to process messages by actor type.
   telemetry::dbl_histogram_family* processing_time;
@@ -126,7 +143,13 @@ struct base_metrics_t {
   telemetry::dbl_histogram_family* mailbox_time;
 
   /// Counts how many messages are currently waiting in the mailbox.
-  telemetry::int_gauge_family* mailbox_size;
+  telemetry::int_gauge_family* mailbox_size = nullptr;
+
+  /// Replaces `mailbox_size` when sharding actor metrics.
+  telemetry::sharded_int_gauge_family* sharded_mailbox_size = nullptr;
+
+  /// Counts how many requests are currently waiting for a response.
+  telemetry::int_gauge_family* pending_requests;
 };
 
 class print_state_impl {
@@ -207,6 +230,9 @@ public:
   using exclusive_guard = std::unique_lock<std::shared_mutex>;
   using shared_guard = std::shared_lock<std::shared_mutex>;
 
+  /// Number of shards for the actor ID mapping. Must be a power of two.
+  static constexpr size_t num_shards = 64;
+
   void erase(actor_id key) override {
     // Stores a reference to the actor we're going to remove. This guarantees
     // that we aren't releasing the last reference to an actor while erasing it.
@@ -215,11 +241,12 @@ public:
     // deadlock.
     strong_actor_ptr ref;
     { // Lifetime scope of guard.
-      exclusive_guard guard{instances_mtx_};
-      auto i = entries_.find(key);
-      if (i != entries_.end()) {
+      auto& shard = shard_of(key);
+      exclusive_guard guard{shard.mtx};
+      auto i = shard.entries.find(key);
+      if (i != shard.entries.end()) {
         ref.swap(i->second);
-        entries_.erase(i);
+        shard.entries.erase(i);
       }
     }
   }
@@ -253,9 +280,14 @@ public:
 
   // Stops this component.
   void stop() {
-    {
-      exclusive_guard guard{instances_mtx_};
-      entries_.clear();
+    for (auto& shard : shards_) {
+      // Move the entries out of the shard to release the references without
+      // holding the lock (see erase).
+      entry_map tmp;
+      {
+        exclusive_guard guard{shard.mtx};
+        tmp.swap(shard.entries);
+      }
     }
     {
       exclusive_guard guard{named_entries_mtx_};
@@ -264,10 +296,29 @@ public:
   }
 
 private:
+  using entry_map = std::unordered_map<actor_id, strong_actor_ptr>;
+
+  /// Stores a subset of all registered actors. Each shard has its own lock to
+  /// avoid contention between unrelated lookups, insertions, and removals.
+  struct alignas(CAF_CACHE_LINE_SIZE) shard_type {
+    mutable std::shared_mutex mtx;
+    entry_map entries;
+  };
+
+  shard_type& shard_of(actor_id key) noexcept {
+    // Actor IDs are consecutive, so the lower bits distribute them evenly.
+    return shards_[key & (num_shards - 1)];
+  }
+
+  const shard_type& shard_of(actor_id key) const noexcept {
+    return shards_[key & (num_shards - 1)];
+  }
+
   strong_actor_ptr get_impl(actor_id key) const override {
-    shared_guard guard(instances_mtx_);
-    auto i = entries_.find(key);
-    if (i != entries_.end())
+    auto& shard = shard_of(key);
+    shared_guard guard(shard.mtx);
+    auto i = shard.entries.find(key);
+    if (i != shard.entries.end())
       return i->second;
     log::core::debug("key invalid, assume actor no longer exists: key = {}",
                      key);
@@ -279,8 +330,9 @@ private:
     if (!val)
       return;
     { // lifetime scope of guard
-      exclusive_guard guard(instances_mtx_);
-      if (!entries_.emplace(key, val).second)
+      auto& shard = shard_of(key);
+      exclusive_guard guard(shard.mtx);
+      if (!shard.entries.emplace(key, val).second)
         return;
     }
     // attach functor without lock
@@ -306,10 +358,7 @@ private:
     named_entries_.emplace(std::move(key), std::move(val));
   }
 
-  using entries = std::unordered_map<actor_id, strong_actor_ptr>;
-
-  mutable std::shared_mutex instances_mtx_;
-  entries entries_;
+  std::array<shard_type, num_shards> shards_;
 
   name_map named_entries_;
   mutable std::shared_mutex named_entries_mtx_;
@@ -329,9 +378,9 @@ public:
   default_actor_system_impl(actor_system_config& cfg)
     : ids_(0),
       metrics_(cfg),
-      base_metrics_(metrics_),
+      base_metrics_(metrics_, cfg),
       clock_(detail::asynchronous_actor_clock::make(
-        actor_clock_queue_size_gauge(metrics_))),
+        cfg, actor_clock_queue_size_gauge(metrics_))),
       cfg_(&cfg),
       private_threads_() {
     memset(&flags_, 0xFF, sizeof(flags_)); // All flags are ON by default.
@@ -391,6 +440,8 @@ public:
       auto config_policy = get_or(*cfg_, "caf.scheduler.policy", policy);
       if (config_policy == "sharing") {
         scheduler_ = scheduler::make_work_sharing(owner);
+      } else if (config_policy == "lock-free-stealing") {
+        scheduler_ = scheduler::make_lock_free_work_stealing(owner);
       } else {
         // Any invalid configuration falls back to work stealing.
         if (config_policy != "stealing")
@@ -457,14 +508,24 @@ public:
       = std::ranges::any_of(metrics_actors_includes_, matches)
         && std::ranges::none_of(metrics_actors_excludes_, matches);
     if (enable_optional_metrics) {
-      result.processed_messages
-        = base_metrics_.processed_messages->get_or_add({{"name", name}});
+      if (base_metrics_.sharded_processed_messages) {
+        result.processed_messages
+          = base_metrics_.sharded_processed_messages->get_or_add(
+            {{"name", name}});
+        result.mailbox_size
+          = base_metrics_.sharded_mailbox_size->get_or_add({{"name", name}});
+      } else {
+        result.processed_messages
+          = base_metrics_.processed_messages->get_or_add({{"name", name}});
+        result.mailbox_size
+          = base_metrics_.mailbox_size->get_or_add({{"name", name}});
+      }
       result.processing_time
         = base_metrics_.processing_time->get_or_add({{"name", name}});
       result.mailbox_time
         = base_metrics_.mailbox_time->get_or_add({{"name", name}});
-      result.mailbox_size
-        = base_metrics_.mailbox_size->get_or_add({{"name", name}});
+      result.pending_requests
+        = base_metrics_.pending_requests->get_or_add({{"name", name}});
     }
     return result;
   }
@@ -122,9 +122,12 @@ actor_system_config::actor_system_config() {
     .add<std::string>("config-file", "sets a path to a configuration file");
   opt_group{custom_options_, "caf.clock"} //
     .add<timespan>("cleanup-interval",
-                   "interval for cleaning up disposed jobs from the clock");
+                   "interval for cleaning up disposed jobs from the clock")
+    .add<std::string>("type", "'heap' (default) or 'timing-wheel'")
+    .add<timespan>("tick-interval", "resolution of the 'timing-wheel' clock");
   opt_group{custom_options_, "caf.scheduler"}
-    .add<std::string>("policy", "'stealing' (default) or 'sharing'")
+    .add<std::string>("policy", "'stealing' (default), 'lock-free-stealing' "
+                                "or 'sharing'")
     .add<size_t>("max-threads", "maximum number of worker threads")
     .add(fields_->max_throughput, "max-throughput",
          "nr. of messages actors can consume per run");
@@ -140,7 +143,14 @@ actor_system_config::actor_system_config() {
     .add<size_t>("relaxed-steal-interval",
                  "frequency of relaxed steal attempts")
     .add<timespan>("relaxed-sleep-duration",
-                   "sleep duration between relaxed steal attempts");
+                   "sleep duration between relaxed steal attempts")
+    .add<std::string>("idle-strategy", "'polling' (default) or 'adaptive'")
+    .add<bool>("topology-aware",
+               "steal from nearby workers first and route external jobs to "
+               "the local NUMA node")
+    .add<bool>("pin-workers", "bind each worker thread to a single CPU")
+    .add<size_t>("max-lifo-polls",
+                 "max. nr. of consecutive jobs from the next-to-run slot");
   opt_group{custom_options_, "caf.logger.file"}
     .add<std::string>("path", "filesystem path for the log file")
     .add<std::string>("format", "format for individual log file entries")
@@ -155,7 +165,9 @@ actor_system_config::actor_system_config() {
                                    "excluded components on console");
   opt_group{custom_options_, "caf.metrics"} //
     .add<bool>("disable-running-actors",
-               "sets whether to collect metrics for running actors per type");
+               "sets whether to collect metrics for running actors per type")
+    .add<bool>("shard-actor-metrics",
+               "spreads per-actor counters over per-thread shards");
   opt_group{custom_options_, "caf.metrics.filters.actors"}
     .add<std::vector<std::string>>("includes",
                                    "selects actors for run-time metrics")
@@ -178,6 +190,10 @@ settings actor_system_config::dump_content() const {
   result.erase("dump-config");
   result.erase("config-file");
   auto& caf_group = result["caf"].as_dictionary();
+  // -- clock parameters
+  auto& clock_group = caf_group["clock"].as_dictionary();
+  put_missing(clock_group, "type", defaults::clock::type);
+  put_missing(clock_group, "tick-interval", defaults::clock::tick_interval);
   // -- scheduler parameters
   auto& scheduler_group = caf_group["scheduler"].as_dictionary();
   put_missing(scheduler_group, "policy", defaults::scheduler::policy);
@@ -199,6 +215,14 @@ settings actor_system_config::dump_content() const {
               defaults::work_stealing::relaxed_steal_interval);
   put_missing(work_stealing_group, "relaxed-sleep-duration",
               defaults::work_stealing::relaxed_sleep_duration);
+  put_missing(work_stealing_group, "idle-strategy",
+              defaults::work_stealing::idle_strategy);
+  put_missing(work_stealing_group, "topology-aware",
+              defaults::work_stealing::topology_aware);
+  put_missing(work_stealing_group, "pin-workers",
+              defaults::work_stealing::pin_workers);
+  put_missing(work_stealing_group, "max-lifo-polls",
+              defaults::work_stealing::max_lifo_polls);
   // -- logger parameters
   auto& logger_group = caf_group["logger"].as_dictionary();
   auto& file_group = logger_group["file"].as_dictionary();
@@ -6,6 +6,7 @@
 
 #include "caf/binary_deserializer.hpp"
 #include "caf/binary_serializer.hpp"
+#include "caf/binary_size_calculator.hpp"
 #include "caf/deserializer.hpp"
 #include "caf/detail/assert.hpp"
 #include "caf/detail/meta_object.hpp"
@@ -27,6 +28,11 @@ bool do_save(const detail::meta_object& meta, binary_serializer& sink,
   return meta.save_binary(sink, ptr);
 }
 
+bool do_save(const detail::meta_object& meta, binary_size_calculator& sink,
+             const void* ptr) {
+  return meta.binary_size(sink, ptr);
+}
+
 bool do_load(const detail::meta_object& meta, deserializer& sink, void* ptr) {
   return meta.load(sink, ptr);
 }
@@ -110,6 +116,10 @@ bool batch::save(serializer& f) const {
 bool batch::save(binary_serializer& f) const {
   return save_impl(f);
 }
+
+bool batch::save(binary_size_calculator& f) const {
+  return save_impl(f);
+}
 template <class Inspector>
 bool batch::load_impl(Inspector& source) {
   if (!source.begin_object(type_id_v<batch>, type_name_v<batch>))
@@ -67,6 +67,8 @@ public:
 
   bool save(binary_serializer& f) const;
 
+  bool save(binary_size_calculator& f) const;
+
   bool load(deserializer& f);
 
   bool load(binary_deserializer& f);
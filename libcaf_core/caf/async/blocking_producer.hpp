@@ -10,6 +10,7 @@
 #include "caf/intrusive_ptr.hpp"
 #include "caf/make_counted.hpp"
 
+#include <atomic>
 #include <condition_variable>
 #include <optional>
 #include <span>
@@ -68,9 +69,8 @@ public:
       }
     }
 
-    bool canceled() const {
-      std::unique_lock<std::mutex> guard{mtx_};
-      return demand_ == -1;
+    bool canceled() const noexcept {
+      return canceled_.load(std::memory_order_acquire);
     }
 
     void on_consumer_ready() override {
@@ -80,6 +80,7 @@ public:
     void on_consumer_cancel() override {
       std::unique_lock<std::mutex> guard{mtx_};
       demand_ = -1;
+      canceled_.store(true, std::memory_order_release);
       cv_.notify_all();
     }
 
@@ -106,6 +107,7 @@ public:
     mutable std::mutex mtx_;
     std::condition_variable cv_;
     ptrdiff_t demand_ = 0;
+    std::atomic<bool> canceled_ = false;
   };
 
   using impl_ptr = intrusive_ptr<impl>;
@@ -165,7 +167,7 @@ public:
   }
 
   /// Checks whether the consumer canceled its subscription.
-  bool canceled() const {
+  bool canceled() const noexcept {
     return impl_->canceled();
   }
 
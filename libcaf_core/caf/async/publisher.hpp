@@ -99,9 +99,10 @@ private:
       // Short circuit if we are already on the target coordinator.
       if (parent == source_.get())
         return decorated_;
-      // Otherwise, create a new SPSC buffer and connect it to the source.
-      auto [pull, push] = async::make_spsc_buffer_resource<T>(buffer_size,
-                                                              min_request_size);
+      // Otherwise, create a new SPSC buffer and connect it to the source. Only
+      // the source pushes to the buffer, so we can skip the locking.
+      auto [pull, push] = async::make_spsc_buffer_resource<T>(
+        buffer_size, min_request_size, async::spsc_buffer_mode::lock_free);
       source_->schedule_fn(
         [push = std::move(push), decorated = decorated_]() mutable {
           decorated.subscribe(std::move(push));
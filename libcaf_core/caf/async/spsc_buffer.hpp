@@ -22,14 +22,33 @@
 #include "caf/resumable.hpp"
 #include "caf/sec.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <bit>
 #include <condition_variable>
+#include <cstddef>
 #include <cstdlib>
 #include <memory>
 #include <mutex>
+#include <new>
 #include <span>
+#include <utility>
 
 namespace caf::async {
 
+/// Selects how an @ref spsc_buffer stores its items.
+enum class spsc_buffer_mode {
+  /// Stores items in a `std::vector` and guards all accesses with a mutex.
+  /// Multiple threads may push to the buffer concurrently.
+  locked,
+  /// Stores items in a fixed-capacity ring buffer that the producer and the
+  /// consumer access without locking. Items that do not fit into the ring go
+  /// to a mutex-protected overflow buffer. The consumer still takes the mutex
+  /// for signaling demand to the producer. Only one thread at a time may push
+  /// to the buffer.
+  lock_free,
+};
+
 /// A Single Producer Single Consumer buffer. The buffer uses a "soft bound",
 /// which means that the producer announces a desired maximum for in-flight
 /// items that the buffer uses for its bookkeeping, but the producer may add
@@ -55,22 +74,39 @@ public:
     bool canceled : 1;
   };
 
-  spsc_buffer(size_t capacity, size_t min_pull_size)
-    : capacity_(capacity), min_pull_size_(min_pull_size) {
+  spsc_buffer(size_t capacity, size_t min_pull_size,
+              spsc_buffer_mode mode = spsc_buffer_mode::locked)
+    : capacity_(capacity), min_pull_size_(min_pull_size), mode_(mode) {
     memset(&flags_, 0, sizeof(flags));
     // Allocate some extra space in the buffer in case the producer goes beyond
-    // the announced capacity.
-    buf_.reserve(capacity + (capacity / 2));
+    // the announced capacity. In lock-free mode, `buf_` only stores items that
+    // do not fit into the ring.
+    if (mode == spsc_buffer_mode::locked) {
+      buf_.reserve(capacity + (capacity / 2));
+    } else {
+      auto ring_size = std::bit_ceil(std::max(capacity + (capacity / 2),
+                                              size_t{2}));
+      ring_mask_ = ring_size - 1;
+      ring_ = std::make_unique<ring_slot[]>(ring_size);
+    }
     // Note: this buffer can never go above its limit since it's a short-term
     // buffer for the consumer that cannot ask for more than capacity
     // items.
     consumer_buf_.reserve(capacity);
   }
 
+  ~spsc_buffer() override {
+    auto tail = ring_tail_.load(std::memory_order_relaxed);
+    for (auto i = ring_head_.load(std::memory_order_relaxed); i != tail; ++i)
+      std::destroy_at(slot_at(i));
+  }
+
   /// Appends to the buffer and calls `on_producer_wakeup` on the consumer if
   /// the buffer becomes non-empty.
   /// @returns the remaining capacity after inserting the items.
   size_t push(std::span<const T> items) {
+    if (mode_ == spsc_buffer_mode::lock_free)
+      return push_lock_free(items);
     lock_type guard{mtx_};
     CAF_ASSERT(producer_ != nullptr);
     CAF_ASSERT(!flags_.closed);
@@ -99,6 +135,8 @@ public:
   ///          `on_error` on the observer.
   template <class Policy, class Observer>
   std::pair<bool, size_t> pull(Policy policy, size_t demand, Observer& dst) {
+    if (mode_ == spsc_buffer_mode::lock_free)
+      return pull_lock_free(policy, demand, dst);
     lock_type guard{mtx_};
     return pull_unsafe(guard, policy, demand, dst);
   }
@@ -106,21 +144,21 @@ public:
   /// Checks whether there is any pending data in the buffer.
   bool has_data() const noexcept {
     lock_type guard{mtx_};
-    return !buf_.empty();
+    return size_unsafe() > 0;
   }
 
   /// Checks whether the there is data available or whether the producer has
   /// closed or aborted the flow.
   bool has_consumer_event() const noexcept {
     lock_type guard{mtx_};
-    return !buf_.empty() || flags_.closed;
+    return size_unsafe() > 0 || flags_.closed;
   }
 
   /// Returns how many items are currently available. This may be greater than
   /// the `capacity`.
   size_t available() const noexcept {
     lock_type guard{mtx_};
-    return buf_.size();
+    return size_unsafe();
   }
 
   /// Returns the error from the producer or a default-constructed error if
@@ -143,7 +181,8 @@ public:
       flags_.closed = true;
       err_ = std::move(reason);
       producer_ = nullptr;
-      if (buf_.empty() && consumer_)
+      closed_.store(true, std::memory_order_seq_cst);
+      if (size_unsafe() == 0 && consumer_)
         consumer_->on_producer_wakeup();
     }
   }
@@ -190,6 +229,11 @@ public:
     return capacity_;
   }
 
+  /// Returns the storage mode as passed to the constructor of the buffer.
+  spsc_buffer_mode mode() const noexcept {
+    return mode_;
+  }
+
   // -- unsafe interface for manual locking ------------------------------------
 
   /// Returns the mutex for this object.
@@ -200,7 +244,7 @@ public:
   /// Returns how many items are currently available.
   /// @pre 'mtx()' is locked.
   size_t available_unsafe() const noexcept {
-    return buf_.size();
+    return size_unsafe();
   }
 
   /// Returns the error from the producer.
@@ -212,7 +256,7 @@ public:
   /// Blocks until there is at least one item available or the producer stopped.
   /// @pre the consumer calls `cv.notify_all()` in its `on_producer_wakeup`
   void await_consumer_ready(lock_type& guard, std::condition_variable& cv) {
-    while (!flags_.closed && buf_.empty()) {
+    while (!flags_.closed && size_unsafe() == 0) {
       cv.wait(guard);
     }
   }
@@ -223,7 +267,7 @@ public:
   template <class TimePoint>
   bool await_consumer_ready(lock_type& guard, std::condition_variable& cv,
                             TimePoint timeout) {
-    while (!flags_.closed && buf_.empty())
+    while (!flags_.closed && size_unsafe() == 0)
       if (cv.wait_until(guard, timeout) == std::cv_status::timeout)
         return false;
     return true;
@@ -231,7 +275,13 @@ public:
 
   template <class Policy, class Observer>
   std::pair<bool, size_t>
-  pull_unsafe(lock_type& guard, Policy, size_t demand, Observer& dst) {
+  pull_unsafe(lock_type& guard, Policy policy, size_t demand, Observer& dst) {
+    if (mode_ == spsc_buffer_mode::lock_free) {
+      guard.unlock();
+      auto result = pull_lock_free(policy, demand, dst);
+      guard.lock();
+      return result;
+    }
     CAF_ASSERT(consumer_ != nullptr);
     CAF_ASSERT(consumer_buf_.empty());
     if constexpr (std::is_same_v<Policy, prioritize_errors_t>) {
@@ -277,13 +327,156 @@ public:
   }
 
 private:
+  /// Raw storage for a single item in the ring.
+  struct ring_slot {
+    alignas(T) std::byte storage[sizeof(T)];
+  };
+
+  void* slot_storage(size_t index) noexcept {
+    return ring_[index & ring_mask_].storage;
+  }
+
+  T* slot_at(size_t index) noexcept {
+    return std::launder(static_cast<T*>(slot_storage(index)));
+  }
+
+  size_t ring_capacity() const noexcept {
+    return ring_mask_ + 1;
+  }
+
+  /// Returns the number of items in the ring and in `buf_`.
+  /// @pre 'mtx()' is locked.
+  size_t size_unsafe() const noexcept {
+    auto head = ring_head_.load(std::memory_order_seq_cst);
+    auto tail = ring_tail_.load(std::memory_order_seq_cst);
+    return (tail - head) + buf_.size();
+  }
+
+  size_t push_lock_free(std::span<const T> items) {
+    // Note: only the producer writes to `ring_tail_` and only the consumer
+    // writes to `ring_head_`. Both store their index before reading the index
+    // of the other side to make sure that at least one side notices a push to
+    // an empty buffer: either the consumer sees the new items or the producer
+    // sees an empty ring and wakes up the consumer.
+    auto tail = ring_tail_.load(std::memory_order_relaxed);
+    if (!spilled_.load(std::memory_order_acquire)) {
+      auto head = ring_head_.load(std::memory_order_acquire);
+      if (ring_capacity() - (tail - head) >= items.size()) {
+        auto old_tail = tail;
+        for (const auto& item : items)
+          std::construct_at(static_cast<T*>(slot_storage(tail++)), item);
+        ring_tail_.store(tail, std::memory_order_seq_cst);
+        head = ring_head_.load(std::memory_order_seq_cst);
+        if (head == old_tail && !items.empty()) {
+          lock_type guard{mtx_};
+          if (consumer_)
+            consumer_->on_producer_wakeup();
+        }
+        return capacity_ > tail - head ? capacity_ - (tail - head) : 0;
+      }
+    }
+    // Slow path: the ring is full or still has items in the overflow buffer.
+    // Once we have spilled items, we keep adding to `buf_` until the consumer
+    // has drained it to preserve the order of items.
+    lock_type guard{mtx_};
+    CAF_ASSERT(!flags_.closed);
+    spilled_.store(true, std::memory_order_seq_cst);
+    auto head = ring_head_.load(std::memory_order_seq_cst);
+    auto was_empty = head == tail && buf_.empty();
+    buf_.insert(buf_.end(), items.begin(), items.end());
+    spill_size_.store(buf_.size(), std::memory_order_relaxed);
+    if (was_empty && !items.empty() && consumer_)
+      consumer_->on_producer_wakeup();
+    auto size = (tail - head) + buf_.size();
+    return capacity_ > size ? capacity_ - size : 0;
+  }
+
+  template <class Policy, class Observer>
+  std::pair<bool, size_t>
+  pull_lock_free(Policy, size_t demand, Observer& dst) {
+    CAF_ASSERT(consumer_buf_.empty());
+    if constexpr (std::is_same_v<Policy, prioritize_errors_t>) {
+      if (closed_.load(std::memory_order_seq_cst)) {
+        lock_type guard{mtx_};
+        if (err_.valid()) {
+          consumer_ = nullptr;
+          dst.on_error(err_);
+          return {false, 0};
+        }
+      }
+    }
+    size_t consumed = 0;
+    while (demand > 0) {
+      auto head = ring_head_.load(std::memory_order_relaxed);
+      auto tail = ring_tail_.load(std::memory_order_seq_cst);
+      if (auto n = std::min(demand, tail - head); n > 0) {
+        // We must not signal demand to the producer when reading excess
+        // elements from the buffer (see pull_unsafe).
+        auto size = (tail - head) + spill_size_.load(std::memory_order_relaxed);
+        auto overflow = size <= capacity_ ? 0u : size - capacity_;
+        for (auto i = head; i != head + n; ++i) {
+          auto* item = slot_at(i);
+          consumer_buf_.emplace_back(std::move(*item));
+          std::destroy_at(item);
+        }
+        ring_head_.store(head + n, std::memory_order_seq_cst);
+        if (n > overflow) {
+          lock_type guard{mtx_};
+          signal_demand(n - overflow);
+        }
+        deliver(dst);
+        demand -= n;
+        consumed += n;
+        continue;
+      }
+      if (!spilled_.load(std::memory_order_seq_cst))
+        break;
+      // The producer does not add to the ring while `spilled_` is set. Hence,
+      // the ring remains empty until we have drained `buf_`.
+      lock_type guard{mtx_};
+      auto n = std::min(demand, buf_.size());
+      auto overflow = buf_.size() <= capacity_ ? 0u : buf_.size() - capacity_;
+      using std::make_move_iterator;
+      consumer_buf_.assign(make_move_iterator(buf_.begin()),
+                           make_move_iterator(buf_.begin() + n));
+      buf_.erase(buf_.begin(), buf_.begin() + n);
+      spill_size_.store(buf_.size(), std::memory_order_relaxed);
+      if (buf_.empty())
+        spilled_.store(false, std::memory_order_seq_cst);
+      if (n > overflow)
+        signal_demand(n - overflow);
+      guard.unlock();
+      deliver(dst);
+      demand -= n;
+      consumed += n;
+    }
+    if (!closed_.load(std::memory_order_seq_cst))
+      return {true, consumed};
+    lock_type guard{mtx_};
+    if (size_unsafe() > 0)
+      return {true, consumed};
+    consumer_ = nullptr;
+    if (err_.empty())
+      dst.on_complete();
+    else
+      dst.on_error(err_);
+    return {false, consumed};
+  }
+
+  template <class Observer>
+  void deliver(Observer& dst) {
+    for (auto& item : consumer_buf_)
+      dst.on_next(item);
+    consumer_buf_.clear();
+  }
+
   void ready() {
     producer_->on_consumer_ready();
     consumer_->on_producer_ready();
-    if (!buf_.empty()) {
+    if (auto size = size_unsafe(); size > 0) {
       consumer_->on_producer_wakeup();
-      if (capacity_ > buf_.size())
-        signal_demand(capacity_ - buf_.size());
+      if (capacity_ > size)
+        signal_demand(capacity_ - size);
     } else {
       signal_demand(capacity_);
     }
@@ -327,6 +520,32 @@ private:
 
   /// Caches items before passing them to the consumer (without lock).
   std::vector<T> consumer_buf_;
+
+  /// Selects between the locked and the lock-free implementation.
+  spsc_buffer_mode mode_;
+
+  // -- state for the lock-free mode -------------------------------------------
+
+  /// Stores the items in lock-free mode. The size is a power of two.
+  std::unique_ptr<ring_slot[]> ring_;
+
+  /// Masks indexes into `ring_`.
+  size_t ring_mask_ = 0;
+
+  /// Mirrors `flags_.closed` for reading it without lock.
+  std::atomic<bool> closed_ = false;
+
+  /// Stores whether `buf_` contains items that did not fit into the ring.
+  std::atomic<bool> spilled_ = false;
+
+  /// Mirrors `buf_.size()` for reading it without lock.
+  std::atomic<size_t> spill_size_ = 0;
+
+  /// Index of the next item for the consumer. Only the consumer writes to it.
+  alignas(CAF_CACHE_LINE_SIZE) std::atomic<size_t> ring_head_ = 0;
+
+  /// Index of the next free slot. Only the producer writes to it.
+  alignas(CAF_CACHE_LINE_SIZE) std::atomic<size_t> ring_tail_ = 0;
 };
 
 /// @relates spsc_buffer
@@ -899,9 +1118,10 @@ using resource_pair = std::pair<consumer_resource<T1>, producer_resource<T2>>;
 /// buffer.
 template <class T>
 resource_pair<T>
-make_spsc_buffer_resource(size_t buffer_size, size_t min_request_size) {
+make_spsc_buffer_resource(size_t buffer_size, size_t min_request_size,
+                          spsc_buffer_mode mode = spsc_buffer_mode::locked) {
   using buffer_type = spsc_buffer<T>;
-  auto buf = make_counted<buffer_type>(buffer_size, min_request_size);
+  auto buf = make_counted<buffer_type>(buffer_size, min_request_size, mode);
   return {async::consumer_resource<T>{buf}, async::producer_resource<T>{buf}};
 }
 
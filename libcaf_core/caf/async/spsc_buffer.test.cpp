@@ -23,6 +23,8 @@
 #include "caf/scoped_actor.hpp"
 
 #include <memory>
+#include <thread>
+#include <tuple>
 
 using namespace caf;
 using namespace std::literals;
@@ -223,6 +225,139 @@ SCENARIO("SPSC buffers may go past their capacity") {
   }
 }
 
+SCENARIO("lock-free SPSC buffers keep the order of items beyond their ring") {
+  GIVEN("a lock-free SPSC buffer with consumer and producer") {
+    auto prod = make_counted<dummy_producer>();
+    auto cons = make_counted<dummy_consumer>();
+    auto buf = make_counted<async::spsc_buffer<int>>(
+      4, 2, async::spsc_buffer_mode::lock_free);
+    buf->set_producer(prod);
+    buf->set_consumer(cons);
+    check_eq(buf->mode(), async::spsc_buffer_mode::lock_free);
+    check_eq(prod->demand, 4u);
+    WHEN("pushing more items than the ring can hold") {
+      auto inputs = std::vector<int>{};
+      for (int i = 1; i <= 20; ++i) {
+        inputs.push_back(i);
+        buf->push(i);
+      }
+      THEN("the consumer receives all items in order") {
+        check_eq(cons->producer_wakeups, 1u);
+        check_eq(buf->available(), 20u);
+        auto outputs = std::vector<int>{};
+        mock_observer obs{outputs};
+        auto [ok, consumed] = buf->pull(async::delay_errors, 15, obs);
+        check(ok);
+        check_eq(consumed, 15u);
+        std::tie(ok, consumed) = buf->pull(async::delay_errors, 15, obs);
+        check(ok);
+        check_eq(consumed, 5u);
+        check_eq(outputs, inputs);
+        check_eq(buf->available(), 0u);
+        check_eq(prod->demand, 8u);
+      }
+    }
+    WHEN("alternating between pushing and pulling") {
+      auto inputs = std::vector<int>{};
+      auto outputs = std::vector<int>{};
+      mock_observer obs{outputs};
+      for (int i = 0; i < 50; ++i) {
+        for (int j = 0; j < 3; ++j) {
+          inputs.push_back(i * 3 + j);
+          buf->push(i * 3 + j);
+        }
+        buf->pull(async::delay_errors, 2, obs);
+      }
+      THEN("the consumer receives all items in order") {
+        auto [ok, consumed] = buf->pull(async::delay_errors, 100, obs);
+        check(ok);
+        check_eq(consumed, 50u);
+        check_eq(outputs, inputs);
+      }
+    }
+    WHEN("pulling one item at a time after pushing beyond the ring") {
+      auto locked_prod = make_counted<dummy_producer>();
+      auto locked_buf = make_counted<async::spsc_buffer<int>>(4, 2);
+      locked_buf->set_producer(locked_prod);
+      locked_buf->set_consumer(make_counted<dummy_consumer>());
+      for (int i = 1; i <= 10; ++i) {
+        buf->push(i);
+        locked_buf->push(i);
+      }
+      THEN("the producer receives the same demand as in locked mode") {
+        dummy_observer obs;
+        for (int i = 0; i < 10; ++i) {
+          buf->pull(async::delay_errors, 1, obs);
+          locked_buf->pull(async::delay_errors, 1, obs);
+        }
+        check_eq(obs.consumed, 20u);
+        check_eq(prod->demand, locked_prod->demand);
+      }
+    }
+    WHEN("closing the buffer after pushing") {
+      auto tmp = std::vector<int>{1, 2, 3};
+      buf->push(std::span{tmp});
+      buf->close();
+      THEN("the consumer receives the items before on_complete") {
+        auto outputs = std::vector<int>{};
+        mock_observer obs{outputs};
+        auto [ok, consumed] = buf->pull(async::delay_errors, 10, obs);
+        check(!ok);
+        check_eq(consumed, 3u);
+        check_eq(outputs, tmp);
+        check(obs.completed);
+      }
+    }
+    WHEN("aborting the buffer after pushing") {
+      auto tmp = std::vector<int>{1, 2, 3};
+      buf->push(std::span{tmp});
+      buf->abort(sec::runtime_error);
+      THEN("prioritize_errors skips the remaining items") {
+        dummy_observer obs;
+        auto [ok, consumed] = buf->pull(async::prioritize_errors, 10, obs);
+        check(!ok);
+        check_eq(consumed, 0u);
+        check_eq(obs.err, sec::runtime_error);
+      }
+    }
+  }
+}
+
+SCENARIO("lock-free SPSC buffers move items between threads") {
+  GIVEN("a lock-free SPSC buffer with consumer and producer") {
+    auto prod = make_counted<dummy_producer>();
+    auto cons = make_counted<dummy_consumer>();
+    auto buf = make_counted<async::spsc_buffer<int>>(
+      8, 4, async::spsc_buffer_mode::lock_free);
+    buf->set_producer(prod);
+    buf->set_consumer(cons);
+    WHEN("a producer thread pushes items while the consumer pulls them") {
+      THEN("the consumer receives all items in order") {
+        auto inputs = std::vector<int>{};
+        for (int i = 0; i < 10'000; ++i)
+          inputs.push_back(i);
+        std::thread producer_thread{[buf, &inputs] {
+          for (auto x : inputs)
+            buf->push(x);
+          buf->close();
+        }};
+        auto outputs = std::vector<int>{};
+        mock_observer obs{outputs};
+        for (;;) {
+          auto [again, consumed] = buf->pull(async::delay_errors, 16, obs);
+          if (!again)
+            break;
+          if (consumed == 0)
+            std::this_thread::yield();
+        }
+        producer_thread.join();
+        check(obs.completed);
+        check_eq(outputs, inputs);
+      }
+    }
+  }
+}
+
 SCENARIO("the prioritize_errors policy skips processing of pending items") {
   GIVEN("an SPSC buffer with consumer and producer") {
     auto prod = make_counted<dummy_producer>();
@@ -282,6 +417,33 @@ SCENARIO("SPSC buffers moves data between actors") {
   }
 }
 
+SCENARIO("lock-free SPSC buffers move data between actors") {
+  GIVEN("an SPSC buffer resource in lock-free mode") {
+    WHEN("opening the resource from two actors") {
+      THEN("data travels through the SPSC buffer") {
+        using actor_t = event_based_actor;
+        auto [rd, wr] = async::make_spsc_buffer_resource<int>(
+          6, 2, async::spsc_buffer_mode::lock_free);
+        auto inputs = std::vector<int>{};
+        for (int i = 0; i < 100; ++i)
+          inputs.push_back(i);
+        auto outputs = std::vector<int>{};
+        sys.spawn([wr{wr}, &inputs](actor_t* src) {
+          src->make_observable().from_container(inputs).subscribe(wr);
+        });
+        sys.spawn([rd{rd}, &outputs](actor_t* snk) {
+          snk
+            ->make_observable() //
+            .from_resource(rd)
+            .for_each([&outputs](int x) { outputs.emplace_back(x); });
+        });
+        dispatch_messages();
+        check_eq(inputs, outputs);
+      }
+    }
+  }
+}
+
 SCENARIO("SPSC buffers appear empty when only one actor is connected") {
   GIVEN("an SPSC buffer resource") {
     WHEN("destroying the write end before adding a subscriber") {
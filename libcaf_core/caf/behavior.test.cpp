@@ -165,6 +165,52 @@ TEST("a handler that takes a message argument is a catch-all handler") {
   }
 }
 
+TEST("behaviors with many handlers preserve the matching order") {
+  // Behaviors with at least behavior_dispatch_index::min_handlers handlers
+  // use a dispatch index instead of trying each handler in turn.
+  auto m4 = make_message(1, 2, 3, 4);
+  auto str = make_message("hello"s);
+  auto ex = make_message(exit_msg{actor_addr{}, exit_reason::user_shutdown});
+  SECTION("without catch-all handler") {
+    auto f = behavior{
+      [](int x) { return x + 1; },
+      [](int, int) { return 10; },
+      [](int) { return 20; },
+      [](int, int, int) { return 30; },
+      [](double) { return 40; },
+      [](float) { return 50; },
+      [](int8_t) { return 60; },
+      [](int16_t) { return 70; },
+      [](int, int, int, int) { return 80; },
+    };
+    check_eq(res_of(f, m1), 2);
+    check_eq(res_of(f, m2), 10);
+    check_eq(res_of(f, m3), 30);
+    check_eq(res_of(f, m4), 80);
+    check_eq(res_of(f, str), std::nullopt);
+  }
+  SECTION("with catch-all handler") {
+    auto f = behavior{
+      [](int x) { return x + 1; },
+      [](int, int) { return 10; },
+      [](int, int, int) { return 30; },
+      [](message) { return 0; },
+      [](double) { return 40; },
+      [](float) { return 50; },
+      [](int8_t) { return 60; },
+      [](int16_t) { return 70; },
+      [](int, int, int, int) { return 80; },
+      [](exit_msg) { return 90; },
+    };
+    check_eq(res_of(f, m1), 2);
+    check_eq(res_of(f, m2), 10);
+    check_eq(res_of(f, m3), 30);
+    check_eq(res_of(f, m4), 0);
+    check_eq(res_of(f, str), 0);
+    check_eq(res_of(f, ex), 90);
+  }
+}
+
 TEST("mutable references in a message handler forces a message to detach") {
   auto str = cow_string{"hello"s};
   auto msg = make_message(str);
@@ -5,11 +5,15 @@
 #include "caf/binary_deserializer.hpp"
 
 #include "caf/actor_system.hpp"
+#include "caf/detail/concepts.hpp"
 #include "caf/detail/ieee_754.hpp"
 #include "caf/detail/network_order.hpp"
 #include "caf/error.hpp"
 #include "caf/sec.hpp"
 
+#include <bit>
+#include <cstring>
+#include <limits>
 #include <sstream>
 #include <type_traits>
 
@@ -18,6 +22,39 @@ namespace {
 template <class T>
 constexpr size_t max_value = static_cast<size_t>(std::numeric_limits<T>::max());
 
+/// Reads `xs.size()` values in network byte order from `in`. Inverse operation
+/// of `write_bulk` in binary_serializer.cpp.
+template <class T>
+void read_bulk(const std::byte* in, std::span<T> xs) noexcept {
+  using namespace caf;
+  if constexpr (sizeof(T) == 1) {
+    memcpy(xs.data(), in, xs.size());
+  } else if constexpr (std::is_floating_point_v<T>) {
+    static_assert(std::numeric_limits<T>::is_iec559);
+    using packed_type = typename detail::ieee_754_trait<T>::packed_type;
+    for (auto& x : xs) {
+      packed_type bits;
+      memcpy(&bits, in, sizeof(bits));
+      in += sizeof(bits);
+      bits = detail::from_network_order(bits);
+      if (detail::is_normal754(bits))
+        x = std::bit_cast<T>(bits);
+      else
+        x = detail::unpack754(bits);
+    }
+  } else if constexpr (std::endian::native == std::endian::big) {
+    memcpy(xs.data(), in, xs.size() * sizeof(T));
+  } else {
+    using unsigned_type = std::make_unsigned_t<T>;
+    for (auto& x : xs) {
+      unsigned_type tmp;
+      memcpy(&tmp, in, sizeof(tmp));
+      in += sizeof(tmp);
+      x = static_cast<T>(detail::from_network_order(tmp));
+    }
+  }
+}
+
 } // namespace
 
 namespace caf {
@@ -297,6 +334,19 @@ public:
     return true;
   }
 
+  template <detail::is_bulk_binary_value T>
+  bool value(std::span<T> xs) noexcept {
+    if (xs.size() > remaining() / sizeof(T)) {
+      emplace_error(sec::end_of_stream);
+      return false;
+    }
+    if (xs.empty())
+      return true;
+    read_bulk(current_, xs);
+    current_ += xs.size() * sizeof(T);
+    return true;
+  }
+
   bool value(std::string& x) {
     x.clear();
     size_t str_size = 0;
@@ -690,6 +740,46 @@ bool binary_deserializer::value(std::vector<bool>& x) {
   return impl_->value(x);
 }
 
+bool binary_deserializer::value(std::span<int8_t> xs) noexcept {
+  return impl_->value(xs);
+}
+
+bool binary_deserializer::value(std::span<uint8_t> xs) noexcept {
+  return impl_->value(xs);
+}
+
+bool binary_deserializer::value(std::span<int16_t> xs) noexcept {
+  return impl_->value(xs);
+}
+
+bool binary_deserializer::value(std::span<uint16_t> xs) noexcept {
+  return impl_->value(xs);
+}
+
+bool binary_deserializer::value(std::span<int32_t> xs) noexcept {
+  return impl_->value(xs);
+}
+
+bool binary_deserializer::value(std::span<uint32_t> xs) noexcept {
+  return impl_->value(xs);
+}
+
+bool binary_deserializer::value(std::span<int64_t> xs) noexcept {
+  return impl_->value(xs);
+}
+
+bool binary_deserializer::value(std::span<uint64_t> xs) noexcept {
+  return impl_->value(xs);
+}
+
+bool binary_deserializer::value(std::span<float> xs) noexcept {
+  return impl_->value(xs);
+}
+
+bool binary_deserializer::value(std::span<double> xs) noexcept {
+  return impl_->value(xs);
+}
+
 bool binary_deserializer::value(strong_actor_ptr& ptr) {
   return impl_->value(ptr);
 }
@@ -4,13 +4,16 @@
 
 #pragma once
 
+#include "caf/detail/concepts.hpp"
 #include "caf/detail/core_export.hpp"
 #include "caf/fwd.hpp"
 #include "caf/load_inspector_base.hpp"
 #include "caf/placement_ptr.hpp"
+#include "caf/sec.hpp"
 
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <span>
 
 namespace caf {
@@ -64,6 +67,32 @@ public:
     return false;
   }
 
+  // -- DSL entry points -------------------------------------------------------
+
+  /// Reads a list. Resizable, contiguous containers of integers or floating
+  /// point numbers bypass the element-wise inspection and go to `value` in one
+  /// call.
+  template <class T>
+  bool list(T& xs) {
+    if constexpr (detail::bulk_binary_list<T>
+                  && requires(size_t n) { xs.resize(n); }) {
+      using value_type = std::ranges::range_value_t<T>;
+      xs.clear();
+      auto size = size_t{0};
+      if (!begin_sequence(size))
+        return false;
+      // Check the size before resizing to reject bogus sizes early.
+      if (size > remaining() / sizeof(value_type)) {
+        emplace_error(sec::end_of_stream);
+        return false;
+      }
+      xs.resize(size);
+      return value(std::span{std::ranges::data(xs), size}) && end_sequence();
+    } else {
+      return load_inspector_base<binary_deserializer>::list(xs);
+    }
+  }
+
   // -- overridden member functions --------------------------------------------
 
   void set_error(error stop_reason) override;
@@ -151,6 +180,29 @@ public:
 
   bool value(std::vector<bool>& x);
 
+  /// Reads `xs.size()` values without a size prefix and converts them from
+  /// network byte order in one pass. The overloads for the other integer and
+  /// floating point types behave accordingly.
+  bool value(std::span<int8_t> xs) noexcept;
+
+  bool value(std::span<uint8_t> xs) noexcept;
+
+  bool value(std::span<int16_t> xs) noexcept;
+
+  bool value(std::span<uint16_t> xs) noexcept;
+
+  bool value(std::span<int32_t> xs) noexcept;
+
+  bool value(std::span<uint32_t> xs) noexcept;
+
+  bool value(std::span<int64_t> xs) noexcept;
+
+  bool value(std::span<uint64_t> xs) noexcept;
+
+  bool value(std::span<float> xs) noexcept;
+
+  bool value(std::span<double> xs) noexcept;
+
   bool value(strong_actor_ptr& ptr);
 
   bool value(weak_actor_ptr& ptr);
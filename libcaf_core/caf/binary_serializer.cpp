@@ -7,12 +7,17 @@
 #include "caf/actor_system.hpp"
 #include "caf/byte_buffer.hpp"
 #include "caf/detail/assert.hpp"
+#include "caf/detail/concepts.hpp"
 #include "caf/detail/ieee_754.hpp"
 #include "caf/detail/network_order.hpp"
 #include "caf/detail/squashed_int.hpp"
 
+#include <bit>
+#include <cstring>
 #include <iomanip>
+#include <limits>
 #include <span>
+#include <type_traits>
 
 namespace {
 
@@ -25,6 +30,39 @@ T compress_index(bool is_present, size_t value) {
   return is_present ? static_cast<T>(value) : T{-1};
 }
 
+/// Writes `xs` in network byte order to `out`. Floating point numbers use their
+/// native IEEE 754 representation unless `pack754` produces a different output,
+/// i.e., for zeros, subnormal numbers, infinities and NaNs. The fallback keeps
+/// the output identical to element-wise serialization, including its lossy
+/// encoding of subnormal numbers.
+template <class T>
+void write_bulk(std::byte* out, std::span<const T> xs) noexcept {
+  using namespace caf;
+  if constexpr (sizeof(T) == 1) {
+    memcpy(out, xs.data(), xs.size());
+  } else if constexpr (std::is_floating_point_v<T>) {
+    static_assert(std::numeric_limits<T>::is_iec559);
+    using packed_type = typename detail::ieee_754_trait<T>::packed_type;
+    for (auto x : xs) {
+      auto bits = std::bit_cast<packed_type>(x);
+      if (!detail::is_normal754(bits))
+        bits = detail::pack754(x);
+      bits = detail::to_network_order(bits);
+      memcpy(out, &bits, sizeof(bits));
+      out += sizeof(bits);
+    }
+  } else if constexpr (std::endian::native == std::endian::big) {
+    memcpy(out, xs.data(), xs.size() * sizeof(T));
+  } else {
+    using unsigned_type = std::make_unsigned_t<T>;
+    for (auto x : xs) {
+      auto y = detail::to_network_order(static_cast<unsigned_type>(x));
+      memcpy(out, &y, sizeof(y));
+      out += sizeof(y);
+    }
+  }
+}
+
 } // namespace
 
 namespace caf {
@@ -372,6 +410,19 @@ public:
     return end_sequence();
   }
 
+  template <detail::is_bulk_binary_value T>
+  bool value(std::span<const T> xs) {
+    if (xs.empty())
+      return true;
+    // Grow the buffer only once and then convert the values in place.
+    auto num_bytes = xs.size() * sizeof(T);
+    if (buf_.size() < write_pos_ + num_bytes)
+      buf_.resize(write_pos_ + num_bytes);
+    write_bulk(buf_.data() + write_pos_, xs);
+    write_pos_ += num_bytes;
+    return true;
+  }
+
   virtual bool value(const strong_actor_ptr& ptr) {
     actor_id aid = 0;
     node_id nid;
@@ -611,6 +662,46 @@ bool binary_serializer::value(const std::vector<bool>& x) {
   return impl_->value(x);
 }
 
+bool binary_serializer::value(std::span<const int8_t> xs) {
+  return impl_->value(xs);
+}
+
+bool binary_serializer::value(std::span<const uint8_t> xs) {
+  return impl_->value(xs);
+}
+
+bool binary_serializer::value(std::span<const int16_t> xs) {
+  return impl_->value(xs);
+}
+
+bool binary_serializer::value(std::span<const uint16_t> xs) {
+  return impl_->value(xs);
+}
+
+bool binary_serializer::value(std::span<const int32_t> xs) {
+  return impl_->value(xs);
+}
+
+bool binary_serializer::value(std::span<const uint32_t> xs) {
+  return impl_->value(xs);
+}
+
+bool binary_serializer::value(std::span<const int64_t> xs) {
+  return impl_->value(xs);
+}
+
+bool binary_serializer::value(std::span<const uint64_t> xs) {
+  return impl_->value(xs);
+}
+
+bool binary_serializer::value(std::span<const float> xs) {
+  return impl_->value(xs);
+}
+
+bool binary_serializer::value(std::span<const double> xs) {
+  return impl_->value(xs);
+}
+
 bool binary_serializer::value(const strong_actor_ptr& ptr) {
   return impl_->value(ptr);
 }
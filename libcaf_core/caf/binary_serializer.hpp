@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "caf/detail/concepts.hpp"
 #include "caf/detail/core_export.hpp"
 #include "caf/fwd.hpp"
 #include "caf/placement_ptr.hpp"
@@ -11,6 +12,8 @@
 
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
+#include <span>
 
 namespace caf {
 
@@ -58,6 +61,20 @@ public:
   /// when skipping past the end.
   void skip(size_t num_bytes);
 
+  // -- DSL entry points -------------------------------------------------------
+
+  /// Writes a list. Contiguous containers of integers or floating point
+  /// numbers bypass the element-wise inspection and go to `value` in one call.
+  template <class T>
+  bool list(const T& xs) {
+    if constexpr (detail::bulk_binary_list<const T>) {
+      auto items = std::span{std::ranges::data(xs), std::ranges::size(xs)};
+      return begin_sequence(items.size()) && value(items) && end_sequence();
+    } else {
+      return save_inspector_base<binary_serializer>::list(xs);
+    }
+  }
+
   // -- interface functions ----------------------------------------------------
 
   void set_error(error stop_reason) override;
@@ -137,6 +154,30 @@ public:
 
   bool value(const std::vector<bool>& x);
 
+  /// Writes all values in `xs` without a size prefix. Reserves the required
+  /// space once and converts the values to network byte order in one pass.
+  /// The overloads for the other integer and floating point types behave
+  /// accordingly.
+  bool value(std::span<const int8_t> xs);
+
+  bool value(std::span<const uint8_t> xs);
+
+  bool value(std::span<const int16_t> xs);
+
+  bool value(std::span<const uint16_t> xs);
+
+  bool value(std::span<const int32_t> xs);
+
+  bool value(std::span<const uint32_t> xs);
+
+  bool value(std::span<const int64_t> xs);
+
+  bool value(std::span<const uint64_t> xs);
+
+  bool value(std::span<const float> xs);
+
+  bool value(std::span<const double> xs);
+
   bool value(const strong_actor_ptr& ptr);
 
   bool value(const weak_actor_ptr& ptr);
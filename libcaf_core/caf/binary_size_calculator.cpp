@@ -0,0 +1,71 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/binary_size_calculator.hpp"
+
+#include "caf/actor_control_block.hpp"
+#include "caf/node_id.hpp"
+
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+namespace caf {
+
+namespace {
+
+template <class T>
+constexpr size_t max_value = static_cast<size_t>(std::numeric_limits<T>::max());
+
+} // namespace
+
+binary_size_calculator::~binary_size_calculator() {
+  // nop
+}
+
+void binary_size_calculator::set_error(error stop_reason) {
+  err_ = std::move(stop_reason);
+}
+
+error& binary_size_calculator::get_error() noexcept {
+  return err_;
+}
+
+bool binary_size_calculator::value(long double x) {
+  // The binary serializer falls back to a string representation for long
+  // double, so we have to render the value to compute its size.
+  std::ostringstream oss;
+  oss << std::setprecision(std::numeric_limits<long double>::digits) << x;
+  auto tmp = oss.str();
+  return value(tmp);
+}
+
+bool binary_size_calculator::value(const strong_actor_ptr& ptr) {
+  actor_id aid = 0;
+  node_id nid;
+  if (ptr != nullptr) {
+    aid = ptr->id();
+    nid = ptr->node();
+  }
+  return value(aid) && inspect(*this, nid);
+}
+
+bool binary_size_calculator::value(const weak_actor_ptr& ptr) {
+  auto tmp = ptr.lock();
+  return value(tmp);
+}
+
+size_t binary_size_calculator::variant_index_size(size_t num_types) noexcept {
+  // Must match binary_serializer::begin_field.
+  if (num_types < max_value<int8_t>)
+    return sizeof(int8_t);
+  else if (num_types < max_value<int16_t>)
+    return sizeof(int16_t);
+  else if (num_types < max_value<int32_t>)
+    return sizeof(int32_t);
+  else
+    return sizeof(int64_t);
+}
+
+} // namespace caf
@@ -0,0 +1,228 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/detail/concepts.hpp"
+#include "caf/detail/core_export.hpp"
+#include "caf/detail/squashed_int.hpp"
+#include "caf/error.hpp"
+#include "caf/fwd.hpp"
+#include "caf/save_inspector_base.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace caf {
+
+/// Computes how many bytes a @ref binary_serializer produces for a sequence of
+/// values without serializing them. Allows users to reserve the exact size of
+/// an output buffer once before serializing large values such as messages.
+class CAF_CORE_EXPORT binary_size_calculator final
+  : public save_inspector_base<binary_size_calculator> {
+public:
+  // -- constructors, destructors, and assignment operators --------------------
+
+  binary_size_calculator() noexcept = default;
+
+  ~binary_size_calculator() override;
+
+  binary_size_calculator(const binary_size_calculator&) = delete;
+
+  binary_size_calculator& operator=(const binary_size_calculator&) = delete;
+
+  // -- properties -------------------------------------------------------------
+
+  /// Returns the number of bytes that a binary serializer would have written
+  /// for all values applied to this calculator so far.
+  size_t result() const noexcept {
+    return result_;
+  }
+
+  /// Sets the result back to zero.
+  void reset() noexcept {
+    result_ = 0;
+  }
+
+  static constexpr bool has_human_readable_format() noexcept {
+    return false;
+  }
+
+  // -- DSL entry points -------------------------------------------------------
+
+  /// Computes the size of a list. Mirrors the bulk path of the binary
+  /// serializer for contiguous containers of integers or floating point
+  /// numbers.
+  template <class T>
+  bool list(const T& xs) {
+    if constexpr (detail::bulk_binary_list<const T>) {
+      using value_type = std::ranges::range_value_t<T>;
+      auto size = std::ranges::size(xs);
+      result_ += sequence_prefix_size(size) + size * sizeof(value_type);
+      return true;
+    } else {
+      return save_inspector_base<binary_size_calculator>::list(xs);
+    }
+  }
+
+  // -- interface functions ----------------------------------------------------
+
+  void set_error(error stop_reason) override;
+
+  error& get_error() noexcept override;
+
+  constexpr bool begin_object(type_id_t, std::string_view) noexcept {
+    return true;
+  }
+
+  constexpr bool end_object() noexcept {
+    return true;
+  }
+
+  constexpr bool begin_field(std::string_view) noexcept {
+    return true;
+  }
+
+  bool begin_field(std::string_view, bool) noexcept {
+    result_ += sizeof(uint8_t);
+    return true;
+  }
+
+  bool begin_field(std::string_view, std::span<const type_id_t> types,
+                   size_t) noexcept {
+    result_ += variant_index_size(types.size());
+    return true;
+  }
+
+  bool begin_field(std::string_view, bool, std::span<const type_id_t> types,
+                   size_t) noexcept {
+    result_ += variant_index_size(types.size());
+    return true;
+  }
+
+  constexpr bool end_field() noexcept {
+    return true;
+  }
+
+  constexpr bool begin_tuple(size_t) noexcept {
+    return true;
+  }
+
+  constexpr bool end_tuple() noexcept {
+    return true;
+  }
+
+  constexpr bool begin_key_value_pair() noexcept {
+    return true;
+  }
+
+  constexpr bool end_key_value_pair() noexcept {
+    return true;
+  }
+
+  bool begin_sequence(size_t list_size) noexcept {
+    result_ += sequence_prefix_size(list_size);
+    return true;
+  }
+
+  constexpr bool end_sequence() noexcept {
+    return true;
+  }
+
+  bool begin_associative_array(size_t size) noexcept {
+    return begin_sequence(size);
+  }
+
+  constexpr bool end_associative_array() noexcept {
+    return true;
+  }
+
+  bool value(std::byte) noexcept {
+    result_ += 1;
+    return true;
+  }
+
+  bool value(bool) noexcept {
+    result_ += 1;
+    return true;
+  }
+
+  template <std::integral T>
+  bool value(T) noexcept {
+    result_ += sizeof(detail::squashed_int_t<T>);
+    return true;
+  }
+
+  bool value(float) noexcept {
+    result_ += sizeof(uint32_t);
+    return true;
+  }
+
+  bool value(double) noexcept {
+    result_ += sizeof(uint64_t);
+    return true;
+  }
+
+  bool value(long double x);
+
+  bool value(std::string_view x) noexcept {
+    result_ += sequence_prefix_size(x.size()) + x.size();
+    return true;
+  }
+
+  bool value(const std::u16string& x) noexcept {
+    result_ += sequence_prefix_size(x.size()) + x.size() * sizeof(uint16_t);
+    return true;
+  }
+
+  bool value(const std::u32string& x) noexcept {
+    result_ += sequence_prefix_size(x.size()) + x.size() * sizeof(uint32_t);
+    return true;
+  }
+
+  bool value(const_byte_span x) noexcept {
+    result_ += x.size();
+    return true;
+  }
+
+  bool value(const std::vector<bool>& x) noexcept {
+    result_ += sequence_prefix_size(x.size()) + (x.size() + 7) / 8;
+    return true;
+  }
+
+  bool value(const strong_actor_ptr& ptr);
+
+  bool value(const weak_actor_ptr& ptr);
+
+  // -- utility functions ------------------------------------------------------
+
+  /// Returns the number of bytes that the binary serializer uses for encoding
+  /// the size of a sequence.
+  static constexpr size_t sequence_prefix_size(size_t list_size) noexcept {
+    // The binary serializer encodes the size as 32-bit varbyte.
+    auto x = static_cast<uint32_t>(list_size);
+    size_t result = 1;
+    while (x > 0x7f) {
+      ++result;
+      x >>= 7;
+    }
+    return result;
+  }
+
+  /// Returns the number of bytes that the binary serializer uses for encoding
+  /// the index of a variant with `num_types` alternatives.
+  static size_t variant_index_size(size_t num_types) noexcept;
+
+private:
+  size_t result_ = 0;
+
+  error err_;
+};
+
+} // namespace caf
@@ -0,0 +1,103 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/binary_size_calculator.hpp"
+
+#include "caf/test/fixture/deterministic.hpp"
+#include "caf/test/test.hpp"
+
+#include "caf/async/batch.hpp"
+#include "caf/binary_serializer.hpp"
+#include "caf/byte_buffer.hpp"
+#include "caf/event_based_actor.hpp"
+#include "caf/message.hpp"
+
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <variant>
+#include <vector>
+
+using namespace caf;
+using namespace std::literals;
+
+namespace {
+
+// Serializes `xs` and checks whether the calculator predicts the output size.
+template <class... Ts>
+void check_size(const Ts&... xs) {
+  auto& this_test = test::runnable::current();
+  byte_buffer buf;
+  binary_serializer sink{buf};
+  this_test.require((sink.apply(xs) && ...));
+  binary_size_calculator calc;
+  this_test.require((calc.apply(xs) && ...));
+  this_test.check_eq(calc.result(), buf.size());
+}
+
+} // namespace
+
+TEST("the calculator computes the size of primitive values") {
+  check_size(int8_t{1}, int16_t{2}, int32_t{3}, int64_t{4}, uint64_t{5});
+  check_size(true, std::byte{1}, 'c', 1.0f, 2.0, 3.0L);
+  check_size(""s, "hello world"s, std::string(200, 'x'), u"hi"s, U"hi"s);
+}
+
+TEST("the calculator computes the size of containers") {
+  check_size(std::vector<int32_t>{}, std::vector<int32_t>(300, 7));
+  check_size(std::vector<double>(100'000, 1.5));
+  check_size(std::vector<bool>(13, true));
+  check_size(std::vector<std::string>{"a", "bb", "ccc"});
+  check_size(std::map<std::string, int>{{"one", 1}, {"two", 2}});
+}
+
+TEST("the calculator computes the size of optional and variant fields") {
+  check_size(std::optional<int32_t>{}, std::optional<int32_t>{42});
+  check_size(std::variant<int32_t, std::string>{"foo"s});
+  check_size(std::variant<int32_t, std::string>{42});
+}
+
+TEST("the calculator computes the size of messages") {
+  check_size(message{});
+  check_size(make_message(1, "two"s, 3.0));
+  check_size(make_message(std::set<std::string>{"a", "b"}, "c"s));
+  check_size(make_message(make_message(1, 2), make_message()));
+}
+
+TEST("the calculator computes the size of batches") {
+  check_size(async::batch{});
+  auto xs = std::vector<int32_t>{1, 2, 3};
+  check_size(async::make_batch(std::span{xs}));
+}
+
+TEST("the calculator accumulates sizes until reset") {
+  binary_size_calculator calc;
+  check(calc.apply(int32_t{1}));
+  check_eq(calc.result(), 4u);
+  check(calc.apply(int64_t{1}));
+  check_eq(calc.result(), 12u);
+  calc.reset();
+  check_eq(calc.result(), 0u);
+}
+
+TEST("the sequence prefix uses a varbyte encoding") {
+  check_eq(binary_size_calculator::sequence_prefix_size(0), 1u);
+  check_eq(binary_size_calculator::sequence_prefix_size(127), 1u);
+  check_eq(binary_size_calculator::sequence_prefix_size(128), 2u);
+  check_eq(binary_size_calculator::sequence_prefix_size(16'383), 2u);
+  check_eq(binary_size_calculator::sequence_prefix_size(16'384), 3u);
+}
+
+WITH_FIXTURE(test::fixture::deterministic) {
+
+TEST("the calculator computes the size of actor handles") {
+  auto hdl = sys.spawn([] { return behavior{[](int) {}}; });
+  check_size(actor{}, hdl, actor_cast<strong_actor_ptr>(hdl));
+  check_size(make_message(hdl, 42));
+  anon_send_exit(hdl, exit_reason::user_shutdown);
+  dispatch_messages();
+}
+
+} // WITH_FIXTURE(test::fixture::deterministic)
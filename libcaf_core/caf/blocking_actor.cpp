@@ -59,17 +59,17 @@ bool blocking_actor::enqueue(mailbox_element_ptr ptr, scheduler*) {
   CAF_LOG_SEND_EVENT(ptr);
   auto mid = ptr->mid;
   auto src = ptr->sender;
-  if (auto* mailbox_size = metrics_.mailbox_size) {
+  if (auto& mailbox_size = metrics_.mailbox_size) {
     ptr->set_enqueue_time();
-    mailbox_size->inc();
+    mailbox_size.inc();
   }
   // returns false if mailbox has been closed
   switch (mailbox().push_back(std::move(ptr))) {
     case intrusive::inbox_result::queue_closed: {
       CAF_LOG_REJECT_EVENT();
       home_system().message_rejected(this);
-      if (auto* mailbox_size = metrics_.mailbox_size) {
-        mailbox_size->dec();
+      if (auto& mailbox_size = metrics_.mailbox_size) {
+        mailbox_size.dec();
       }
       if (mid.is_request()) {
         detail::sync_request_bouncer srb;
@@ -272,7 +272,7 @@ void blocking_actor::receive_impl(receive_cond& rcc, message_id mid,
         auto& builtins = builtin_metrics();
         telemetry::timer::observe(builtins.processing_time, t0);
         builtins.mailbox_time->observe(mbox_time);
-        builtins.mailbox_size->dec();
+        builtins.mailbox_size.dec();
       }
       // Check whether we are done.
       if (!rcc.post() || !rcc.pre()) {
@@ -362,7 +362,7 @@ void blocking_actor::close_mailbox(const error& reason) {
     unstash();
     auto dropped = mailbox_.close(reason);
     if (dropped > 0 && metrics_.mailbox_size)
-      metrics_.mailbox_size->dec(static_cast<int64_t>(dropped));
+      metrics_.mailbox_size.dec(static_cast<int64_t>(dropped));
   }
 }
 
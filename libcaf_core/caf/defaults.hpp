@@ -91,6 +91,18 @@ constexpr auto buffer_size = int32_t{4096}; // // 32 KB for elements of size 8.
 
 } // namespace caf::defaults::stream::token_policy
 
+namespace caf::defaults::clock {
+
+/// Configures the data structure of the actor clock. The `heap` type
+/// (default) keeps all entries in a binary heap. The `timing-wheel` type uses
+/// a hierarchical timing wheel with a resolution of `tick_interval`.
+constexpr auto type = std::string_view{"heap"};
+
+/// Configures the resolution of the `timing-wheel` clock.
+constexpr auto tick_interval = timespan{1'000'000};
+
+} // namespace caf::defaults::clock
+
 namespace caf::defaults::scheduler {
 
 constexpr auto policy = std::string_view{"stealing"};
@@ -108,6 +120,25 @@ constexpr auto moderate_sleep_duration = timespan{50'000};
 constexpr auto relaxed_steal_interval = size_t{1};
 constexpr auto relaxed_sleep_duration = timespan{10'000'000};
 
+/// Configures how idle workers wait for new jobs. The `polling` strategy
+/// (default) uses the aggressive, moderate and relaxed poll intervals. The
+/// `adaptive` strategy spins depending on the recent steal success rate and
+/// then parks the worker until a new job arrives.
+constexpr auto idle_strategy = std::string_view{"polling"};
+
+/// Configures whether workers prefer victims that are close to them in the
+/// CPU topology when stealing and whether external jobs go to a worker on the
+/// NUMA node of the calling thread.
+constexpr auto topology_aware = false;
+
+/// Configures whether each worker thread gets bound to a single CPU.
+constexpr auto pin_workers = false;
+
+/// Configures how many jobs in a row a worker may take from its next-to-run
+/// slot before taking a job from its queue. Setting this to 0 disables the
+/// slot.
+constexpr auto max_lifo_polls = size_t{3};
+
 } // namespace caf::defaults::work_stealing
 
 namespace caf::defaults::logger::file {
@@ -165,6 +196,19 @@ constexpr auto max_connections = make_parameter("max-connections", size_t{64});
 constexpr auto max_consecutive_reads = make_parameter("max-consecutive-reads",
                                                       size_t{50});
 
+/// Configures how the multiplexer waits for I/O events. The `poll` backend
+/// (default) is available on all platforms. The `epoll` backend is available on
+/// Linux only.
+constexpr auto multiplexer = std::string_view{"poll"};
+
+/// Configures how many multiplexers the middleman runs. Each multiplexer runs
+/// in its own thread and handles a share of all socket managers.
+constexpr auto multiplexer_shards = size_t{1};
+
+/// Configures how the middleman distributes new socket managers to its
+/// multiplexers. Either `round-robin` (default) or `least-loaded`.
+constexpr auto shard_policy = std::string_view{"round-robin"};
+
 /// Default maximum size for incoming HTTP requests: 64KiB.
 constexpr auto http_max_request_size = uint32_t{64 * 1024};
 
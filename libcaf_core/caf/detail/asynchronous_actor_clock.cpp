@@ -7,12 +7,18 @@
 #include "caf/action.hpp"
 #include "caf/actor_system.hpp"
 #include "caf/actor_system_config.hpp"
+#include "caf/config.hpp"
+#include "caf/defaults.hpp"
+#include "caf/detail/timing_wheel.hpp"
 #include "caf/log/core.hpp"
 #include "caf/telemetry/gauge.hpp"
 #include "caf/thread_owner.hpp"
 #include "caf/timespan.hpp"
 
+#include <array>
+#include <atomic>
 #include <condition_variable>
+#include <cstdio>
 #include <mutex>
 #include <thread>
 #include <vector>
@@ -222,6 +228,266 @@ private:
   std::thread worker_;
 };
 
+class timing_wheel_actor_clock : public asynchronous_actor_clock {
+public:
+  /// Number of insertion buffers. Each thread that calls `schedule` sticks to
+  /// one buffer in order to spread contention over multiple cache lines.
+  static constexpr size_t num_buffers = 16;
+
+  /// Stores a scheduled action until the clock thread moves it to the wheel.
+  struct node {
+    time_point timeout;
+    caf::action callback;
+    node* next;
+  };
+
+  /// An intrusive, lock-free LIFO list of scheduled actions.
+  struct alignas(CAF_CACHE_LINE_SIZE) buffer {
+    std::atomic<node*> head = nullptr;
+  };
+
+  using wheel_type = timing_wheel<caf::action>;
+
+  using lock_type = std::unique_lock<std::mutex>;
+
+  /// Stored in `next_wakeup_` while the clock thread is running. Threads that
+  /// call `schedule` never wake up the clock thread in this case.
+  static constexpr auto awake = time_point::min().time_since_epoch().count();
+
+  explicit timing_wheel_actor_clock(telemetry::int_gauge* queue_size)
+    : queue_size_(queue_size) {
+    CAF_ASSERT(queue_size != nullptr);
+  }
+
+  ~timing_wheel_actor_clock() override {
+    stop();
+  }
+
+  void start(caf::actor_system& sys) override {
+    CAF_ASSERT(!worker_.joinable());
+    auto cleanup_interval = get_or(sys.config(), "caf.clock.cleanup-interval",
+                                   timespan::zero());
+    tick_interval_ = get_or(sys.config(), "caf.clock.tick-interval",
+                            defaults::clock::tick_interval);
+    if (tick_interval_.count() <= 0)
+      tick_interval_ = defaults::clock::tick_interval;
+    origin_ = now();
+    log::core::info("starting the timing wheel actor clock with tick interval "
+                    "{} and cleanup interval {}",
+                    tick_interval_, cleanup_interval);
+    worker_
+      = sys.launch_thread("caf.clock", caf::thread_owner::system,
+                          [this, cleanup_interval] { run(cleanup_interval); });
+  }
+
+  void stop() override {
+    if (worker_.joinable()) {
+      {
+        lock_type guard{mutex_};
+        stopped_.store(true);
+        wakeup_ = true;
+      }
+      cv_.notify_one();
+      worker_.join();
+      log::core::info("stopped the timing wheel actor clock");
+      worker_ = std::thread{};
+    }
+    stopped_.store(true);
+    drop_all();
+  }
+
+  caf::disposable schedule(time_point timeout, caf::action callback) override {
+    if (!callback) {
+      return {};
+    }
+    if (stopped_.load(std::memory_order_acquire)) {
+      log::core::debug("schedule: clock is stopped, disposing callback");
+      callback.dispose();
+      return {};
+    }
+    queue_size_->inc();
+    auto* new_node = new node{timeout, callback, nullptr};
+    auto& buf = buffers_[buffer_index()];
+    auto head = buf.head.load(std::memory_order_relaxed);
+    do {
+      new_node->next = head;
+    } while (!buf.head.compare_exchange_weak(head, new_node));
+    // Only wake up the clock thread if it sleeps past the new timeout. Pairs
+    // with the store to `next_wakeup_` in `run`, which is followed by another
+    // check of the buffers.
+    if (timeout.time_since_epoch().count() < next_wakeup_.load()) {
+      {
+        lock_type guard{mutex_};
+        wakeup_ = true;
+      }
+      cv_.notify_one();
+    }
+    return std::move(callback).as_disposable();
+  }
+
+private:
+  static size_t buffer_index() noexcept {
+    static std::atomic<size_t> next_index = 0;
+    thread_local auto index
+      = next_index.fetch_add(1, std::memory_order_relaxed) % num_buffers;
+    return index;
+  }
+
+  /// Converts `t` to the first tick that starts at or after `t`.
+  uint64_t tick_ceil(time_point t) const noexcept {
+    if (t <= origin_)
+      return 0;
+    auto delta = (t - origin_).count();
+    auto step = tick_interval_.count();
+    return static_cast<uint64_t>(delta / step + (delta % step != 0 ? 1 : 0));
+  }
+
+  /// Converts `t` to the tick that contains `t`.
+  uint64_t tick_floor(time_point t) const noexcept {
+    if (t <= origin_)
+      return 0;
+    return static_cast<uint64_t>((t - origin_).count()
+                                 / tick_interval_.count());
+  }
+
+  /// Converts `tick` to the point in time where it starts.
+  time_point time_of(uint64_t tick) const noexcept {
+    return origin_ + tick_interval_ * static_cast<timespan::rep>(tick);
+  }
+
+  bool has_buffered() const noexcept {
+    for (auto& buf : buffers_)
+      if (buf.head.load() != nullptr)
+        return true;
+    return false;
+  }
+
+  /// Moves all buffered actions to `f`.
+  template <class F>
+  void drain(F&& f) {
+    for (auto& buf : buffers_) {
+      auto* head = buf.head.exchange(nullptr, std::memory_order_acquire);
+      // Reverse the list to process the actions in the order of insertion.
+      node* list = nullptr;
+      while (head != nullptr) {
+        auto* next = head->next;
+        head->next = list;
+        list = head;
+        head = next;
+      }
+      while (list != nullptr) {
+        auto* next = list->next;
+        f(*list);
+        delete list;
+        list = next;
+      }
+    }
+  }
+
+  /// Moves all buffered actions to the wheel.
+  void drain() {
+    drain([this](node& x) {
+      wheel_.insert(tick_ceil(x.timeout), std::move(x.callback));
+    });
+  }
+
+  void run(timespan cleanup_interval) {
+    auto next_cleanup = cleanup_interval.count() > 0 ? now() + cleanup_interval
+                                                     : time_point::max();
+    for (;;) {
+      drain();
+      auto current_time = now();
+      wheel_.advance(tick_floor(current_time), [this](caf::action& job) {
+        auto fn = std::move(job);
+        queue_size_->dec();
+        fn.run();
+      });
+      if (current_time >= next_cleanup) {
+        cleanup();
+        next_cleanup = current_time + cleanup_interval;
+      }
+      auto next_tick = wheel_.next_tick();
+      auto wakeup_time = next_tick != wheel_type::no_deadline
+                           ? std::min(time_of(next_tick), next_cleanup)
+                           : next_cleanup;
+      lock_type guard{mutex_};
+      if (stopped_.load())
+        return;
+      next_wakeup_.store(wakeup_time.time_since_epoch().count());
+      if (!has_buffered()) {
+        if (wakeup_time == time_point::max()) {
+          while (!wakeup_)
+            cv_.wait(guard);
+        } else {
+          while (!wakeup_ && now() < wakeup_time)
+            cv_.wait_until(guard, wakeup_time);
+        }
+      }
+      wakeup_ = false;
+      next_wakeup_.store(awake);
+    }
+  }
+
+  void cleanup() {
+    drain();
+    auto is_disposed = [](const caf::action& x) { return x.disposed(); };
+    if (auto erased = wheel_.erase_if(is_disposed); erased > 0) {
+      queue_size_->dec(static_cast<int64_t>(erased));
+      log::core::debug("cleanup removed {} disposed entries from the clock",
+                       erased);
+    }
+  }
+
+  /// Disposes all pending actions.
+  /// @pre the clock thread is not running
+  void drop_all() {
+    int64_t dropped = 0;
+    drain([&dropped](node& x) {
+      x.callback.dispose();
+      ++dropped;
+    });
+    dropped += static_cast<int64_t>(wheel_.erase_if([](caf::action& x) {
+      x.dispose();
+      return true;
+    }));
+    if (dropped > 0)
+      queue_size_->dec(dropped);
+  }
+
+  /// Tracks the number of entries in the actor clock queue.
+  telemetry::int_gauge* queue_size_;
+
+  /// Buffers new actions until the clock thread moves them to the wheel.
+  std::array<buffer, num_buffers> buffers_;
+
+  /// Stores the time at which the clock thread wakes up or `awake`.
+  std::atomic<time_point::rep> next_wakeup_ = awake;
+
+  /// Tracks whether `stop` has been called.
+  std::atomic<bool> stopped_ = false;
+
+  /// Guards access to `wakeup_`.
+  std::mutex mutex_;
+
+  /// Signals the worker thread to wake up.
+  std::condition_variable cv_;
+
+  /// Signals the worker thread that new actions may require an earlier wakeup.
+  bool wakeup_ = false;
+
+  /// Stores all actions, only accessed by the clock thread while running.
+  wheel_type wheel_;
+
+  /// The point in time of tick 0.
+  time_point origin_;
+
+  /// The duration of a single tick.
+  timespan tick_interval_ = defaults::clock::tick_interval;
+
+  /// The worker thread that runs the clock.
+  std::thread worker_;
+};
+
 } // namespace
 
 asynchronous_actor_clock::~asynchronous_actor_clock() {
@@ -233,4 +499,19 @@ asynchronous_actor_clock::make(telemetry::int_gauge* queue_size) {
   return std::make_unique<default_actor_clock>(queue_size);
 }
 
+std::unique_ptr<asynchronous_actor_clock>
+asynchronous_actor_clock::make(const actor_system_config& cfg,
+                               telemetry::int_gauge* queue_size) {
+  auto type = get_or(cfg, "caf.clock.type", defaults::clock::type);
+  if (type == "timing-wheel")
+    return std::make_unique<timing_wheel_actor_clock>(queue_size);
+  // Any invalid configuration falls back to the heap.
+  if (type != "heap")
+    fprintf(stderr,
+            "[WARNING] '%s' is an unrecognized clock type, falling back to "
+            "'heap'\n",
+            type.c_str());
+  return make(queue_size);
+}
+
 } // namespace caf::detail
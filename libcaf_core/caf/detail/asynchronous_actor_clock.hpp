@@ -27,6 +27,11 @@ public:
   /// Creates a new asynchronous actor clock instance.
   static std::unique_ptr<asynchronous_actor_clock>
   make(telemetry::int_gauge* queue_size);
+
+  /// Creates a new asynchronous actor clock instance of the type selected by
+  /// `caf.clock.type` in `cfg`.
+  static std::unique_ptr<asynchronous_actor_clock>
+  make(const actor_system_config& cfg, telemetry::int_gauge* queue_size);
 };
 
 } // namespace caf::detail
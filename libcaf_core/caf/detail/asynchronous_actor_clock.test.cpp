@@ -11,7 +11,10 @@
 #include "caf/actor_system_config.hpp"
 #include "caf/telemetry/metric_registry.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <mutex>
+#include <vector>
 
 using namespace caf;
 using namespace std::chrono_literals;
@@ -42,3 +45,48 @@ TEST("setting a cleanup interval removes disposed jobs from the clock") {
                                  10ms, [](int64_t x) { return x == 0; }));
   check_eq(actions->value(), 0);
 }
+
+TEST("the timing wheel clock executes jobs after their timeout") {
+  actor_system_config cfg;
+  cfg.set("caf.clock.type", "timing-wheel");
+  actor_system sys{cfg};
+  auto& clock = sys.clock();
+  auto* actions = sys.metrics().counter_singleton("test", "actions", "test");
+  auto t0 = clock.now();
+  std::vector<actor_clock::time_point> runs;
+  std::mutex runs_mtx;
+  for (auto delay : {20ms, 1ms, 10ms}) {
+    clock.schedule(t0 + delay, make_single_shot_action([&, actions] {
+                     {
+                       std::lock_guard guard{runs_mtx};
+                       runs.push_back(clock.now());
+                     }
+                     actions->inc();
+                   }));
+  }
+  require(sys.metrics().wait_for("test", "actions", 1s, 1ms,
+                                 [](int64_t x) { return x == 3; }));
+  std::lock_guard guard{runs_mtx};
+  require_eq(runs.size(), 3u);
+  check(std::is_sorted(runs.begin(), runs.end()));
+  check_ge(runs[0], t0 + 1ms);
+  check_ge(runs[1], t0 + 10ms);
+  check_ge(runs[2], t0 + 20ms);
+}
+
+TEST("the timing wheel clock removes disposed jobs on cleanup") {
+  actor_system_config cfg;
+  cfg.set("caf.clock.type", "timing-wheel");
+  cfg.set("caf.clock.cleanup-interval", "5ms");
+  actor_system sys{cfg};
+  auto& clock = sys.clock();
+  auto* actions = sys.metrics().counter_singleton("test", "actions", "test");
+  auto hdl = clock.schedule(clock.now() + 1h, make_single_shot_action(
+                                                [actions] { actions->inc(); }));
+  require(sys.metrics().wait_for("caf.system", "actor-clock-queue-size", 1s,
+                                 10ms, [](int64_t x) { return x == 1; }));
+  hdl.dispose();
+  require(sys.metrics().wait_for("caf.system", "actor-clock-queue-size", 1s,
+                                 10ms, [](int64_t x) { return x == 0; }));
+  check_eq(actions->value(), 0);
+}
@@ -0,0 +1,56 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/behavior_dispatch_index.hpp"
+
+#include "caf/hash/fnv.hpp"
+
+namespace caf::detail {
+
+behavior_dispatch_index::behavior_dispatch_index(
+  std::span<const type_id_list> keys) {
+  // Keep the load factor at or below 50% to keep probe sequences short.
+  size_t capacity = 4;
+  while (capacity < keys.size() * 2)
+    capacity <<= 1;
+  mask_ = capacity - 1;
+  entries_.resize(capacity);
+  for (size_t index = 0; index < keys.size(); ++index) {
+    auto key = keys[index];
+    if (!key)
+      continue;
+    for (auto pos = hash(key) & mask_;; pos = (pos + 1) & mask_) {
+      auto& x = entries_[pos];
+      if (!x.key) {
+        x.key = key;
+        x.index = index;
+        break;
+      }
+      // Only the first handler for a signature is reachable.
+      if (x.key == key)
+        break;
+    }
+  }
+}
+
+size_t behavior_dispatch_index::find(type_id_list types) const noexcept {
+  for (auto pos = hash(types) & mask_;; pos = (pos + 1) & mask_) {
+    auto& x = entries_[pos];
+    if (!x.key)
+      return npos;
+    // Locally created messages share the list with the handler signature, so
+    // comparing the pointers first usually avoids comparing the elements.
+    if (x.key.data() == types.data() || x.key == types)
+      return x.index;
+  }
+}
+
+size_t behavior_dispatch_index::hash(type_id_list types) noexcept {
+  hash::fnv<size_t> h;
+  for (auto id : types)
+    h.value(id);
+  return h.result;
+}
+
+} // namespace caf::detail
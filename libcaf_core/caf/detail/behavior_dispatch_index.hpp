@@ -0,0 +1,56 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/detail/core_export.hpp"
+#include "caf/type_id_list.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace caf::detail {
+
+/// Maps the argument types of message handlers to the position of the first
+/// handler for these types. Allows behaviors with many handlers to find the
+/// matching handler for a message with a single lookup instead of comparing
+/// the message types to each handler signature in turn.
+class CAF_CORE_EXPORT behavior_dispatch_index {
+public:
+  // -- constants --------------------------------------------------------------
+
+  /// Returned by `find` if no handler matches.
+  static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+  /// Minimum number of handlers in a behavior for using an index.
+  static constexpr size_t min_handlers = 8;
+
+  // -- constructors, destructors, and assignment operators --------------------
+
+  /// Constructs an index for handlers with the signatures `keys`. A null list
+  /// in `keys` denotes a handler that the index skips, e.g., a catch-all
+  /// handler.
+  explicit behavior_dispatch_index(std::span<const type_id_list> keys);
+
+  // -- lookup -----------------------------------------------------------------
+
+  /// Returns the position of the first handler for `types` or `npos`.
+  size_t find(type_id_list types) const noexcept;
+
+private:
+  struct entry {
+    type_id_list key{nullptr};
+    size_t index = npos;
+  };
+
+  static size_t hash(type_id_list types) noexcept;
+
+  size_t mask_;
+
+  std::vector<entry> entries_;
+};
+
+} // namespace caf::detail
@@ -0,0 +1,46 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/behavior_dispatch_index.hpp"
+
+#include "caf/test/test.hpp"
+
+#include "caf/detail/type_id_list_builder.hpp"
+
+#include <array>
+#include <string>
+
+using namespace caf;
+
+using detail::behavior_dispatch_index;
+
+TEST("the index maps signatures to the first matching handler") {
+  auto keys = std::array{
+    make_type_id_list<int32_t>(),
+    make_type_id_list<int32_t, int32_t>(),
+    type_id_list{nullptr},
+    make_type_id_list<int32_t>(),
+    make_type_id_list<std::string>(),
+    make_type_id_list<>(),
+  };
+  behavior_dispatch_index uut{keys};
+  check_eq(uut.find(make_type_id_list<int32_t>()), 0u);
+  check_eq(uut.find(make_type_id_list<int32_t, int32_t>()), 1u);
+  check_eq(uut.find(make_type_id_list<std::string>()), 4u);
+  check_eq(uut.find(make_type_id_list<>()), 5u);
+  check_eq(uut.find(make_type_id_list<double>()),
+           behavior_dispatch_index::npos);
+}
+
+TEST("the index compares lists by value") {
+  auto keys = std::array{
+    make_type_id_list<int32_t>(),
+    make_type_id_list<int32_t, std::string>(),
+  };
+  behavior_dispatch_index uut{keys};
+  detail::type_id_list_builder builder;
+  builder.push_back(type_id_v<int32_t>);
+  builder.push_back(type_id_v<std::string>);
+  check_eq(uut.find(builder.copy_to_list()), 1u);
+}
@@ -6,6 +6,7 @@
 
 #include "caf/const_typed_message_view.hpp"
 #include "caf/detail/apply_args.hpp"
+#include "caf/detail/behavior_dispatch_index.hpp"
 #include "caf/detail/callable_trait.hpp"
 #include "caf/detail/concepts.hpp"
 #include "caf/detail/core_export.hpp"
@@ -24,6 +25,7 @@
 #include "caf/typed_message_view.hpp"
 #include "caf/typed_response_promise.hpp"
 
+#include <array>
 #include <optional>
 #include <tuple>
 #include <type_traits>
@@ -107,75 +109,149 @@ public:
   }
 
   virtual bool invoke(detail::invoke_result_visitor& f, message& xs) override {
-    return invoke_impl(f, xs, std::make_index_sequence<sizeof...(Ts)>{});
+    if constexpr (use_dispatch_index)
+      return invoke_indexed(f, xs);
+    else
+      return invoke_impl(f, xs, std::make_index_sequence<sizeof...(Ts)>{});
   }
 
   template <size_t... Is>
   bool invoke_impl(detail::invoke_result_visitor& f, message& msg,
                    std::index_sequence<Is...>) {
-    [[maybe_unused]] auto dispatch = [&](auto& fun) {
-      using fun_type = std::decay_t<decltype(fun)>;
-      using trait = get_callable_trait<fun_type>;
-      using fn_args = typename trait::arg_types;
-      using decayed_args = typename trait::decayed_arg_types;
-      if constexpr (std::is_same_v<decayed_args, type_list<message>>) {
-        using fun_result = decltype(fun(msg));
-        if (auto types = msg.types();
-            types.size() == 1 && is_system_message(types[0])) {
-          // The fallback handler must not consume system messages such as
-          // exit_msg. They must be handled explicitly by the actor or else use
-          // the hard-coded default.
-          return false;
-        }
+    return (invoke_case(std::get<Is>(cases_), f, msg) || ...);
+  }
+
+  void handle_timeout() override {
+    timeout_definition_.handler();
+  }
+
+private:
+  // -- dispatching ------------------------------------------------------------
+
+  template <class Fun>
+  static constexpr bool is_catch_all
+    = std::is_same_v<typename get_callable_trait<Fun>::decayed_arg_types,
+                     type_list<message>>;
+
+  /// Position of the first catch-all handler or `npos` if there is none.
+  static constexpr size_t catch_all_index = [] {
+    auto result = behavior_dispatch_index::npos;
+    auto index = size_t{0};
+    auto update = [&](bool catch_all) {
+      if (catch_all && result == behavior_dispatch_index::npos)
+        result = index;
+      ++index;
+    };
+    (update(is_catch_all<Ts>), ...);
+    return result;
+  }();
+
+  /// Enables the dispatch index for behaviors with many handlers.
+  static constexpr bool use_dispatch_index
+    = sizeof...(Ts) >= behavior_dispatch_index::min_handlers;
+
+  template <class Fun>
+  static type_id_list signature_of() {
+    if constexpr (is_catch_all<Fun>)
+      return type_id_list{nullptr};
+    else
+      return to_type_id_list<
+        typename get_callable_trait<Fun>::decayed_arg_types>();
+  }
+
+  /// Returns the index for this behavior type. Since the index only depends on
+  /// the handler signatures, all instances of this type share one index.
+  static const behavior_dispatch_index& dispatch_index() {
+    static const behavior_dispatch_index instance{
+      std::array<type_id_list, sizeof...(Ts)>{{signature_of<Ts>()...}}};
+    return instance;
+  }
+
+  template <size_t I>
+  static bool invoke_case_at(default_behavior_impl& self,
+                             detail::invoke_result_visitor& f, message& msg) {
+    return self.invoke_case(std::get<I>(self.cases_), f, msg);
+  }
+
+  template <size_t... Is>
+  bool invoke_case_by_index(size_t index, detail::invoke_result_visitor& f,
+                            message& msg, std::index_sequence<Is...>) {
+    using case_fn = bool (*)(default_behavior_impl&,
+                             detail::invoke_result_visitor&, message&);
+    static constexpr case_fn cases[] = {&invoke_case_at<Is>...};
+    return cases[index](*this, f, msg);
+  }
+
+  bool invoke_indexed(detail::invoke_result_visitor& f, message& msg) {
+    std::make_index_sequence<sizeof...(Ts)> seq;
+    auto index = dispatch_index().find(msg.types());
+    // Handlers after a catch-all handler are only reachable for system
+    // messages, which the catch-all handler rejects. Fall back to trying each
+    // handler in order to preserve these semantics.
+    if (index < catch_all_index)
+      return invoke_case_by_index(index, f, msg, seq);
+    if constexpr (catch_all_index == behavior_dispatch_index::npos)
+      return false;
+    else
+      return invoke_impl(f, msg, seq);
+  }
+
+  template <class Fun>
+  bool invoke_case(Fun& fun, detail::invoke_result_visitor& f, message& msg) {
+    using fun_type = std::decay_t<decltype(fun)>;
+    using trait = get_callable_trait<fun_type>;
+    using fn_args = typename trait::arg_types;
+    using decayed_args = typename trait::decayed_arg_types;
+    if constexpr (std::is_same_v<decayed_args, type_list<message>>) {
+      using fun_result = decltype(fun(msg));
+      if (auto types = msg.types();
+          types.size() == 1 && is_system_message(types[0])) {
+        // The fallback handler must not consume system messages such as
+        // exit_msg. They must be handled explicitly by the actor or else use
+        // the hard-coded default.
+        return false;
+      }
+      if constexpr (std::is_same_v<void, fun_result>) {
+        fun(msg);
+        f(unit);
+      } else {
+        auto invoke_res = fun(msg);
+        f(invoke_res);
+      }
+      return true;
+    } else {
+      using detail::apply_args_auto_move;
+      auto arg_types = to_type_id_list<decayed_args>();
+      if (arg_types != msg.types())
+        return false;
+      auto do_invoke = [&](auto& xs) {
+        using fun_result = decltype(detail::apply_args(fun, xs));
+        auto token = detail::get_indices(xs);
         if constexpr (std::is_same_v<void, fun_result>) {
-          fun(msg);
+          apply_args_auto_move(fun, fn_args{}, token, xs);
           f(unit);
         } else {
-          auto invoke_res = fun(msg);
+          auto invoke_res = apply_args_auto_move(fun, fn_args{}, token, xs);
           f(invoke_res);
         }
-        return true;
-      } else {
-        using detail::apply_args_auto_move;
-        auto arg_types = to_type_id_list<decayed_args>();
-        if (arg_types != msg.types())
-          return false;
-        auto do_invoke = [&](auto& xs) {
-          using fun_result = decltype(detail::apply_args(fun, xs));
-          auto token = detail::get_indices(xs);
-          if constexpr (std::is_same_v<void, fun_result>) {
-            apply_args_auto_move(fun, fn_args{}, token, xs);
-            f(unit);
-          } else {
-            auto invoke_res = apply_args_auto_move(fun, fn_args{}, token, xs);
-            f(invoke_res);
-          }
-        };
-        using view_type = typename trait::message_view_type;
-        // If we have the only reference to a message, we can safely modify it
-        // in place, i.e., use the mutable view type and move values from the
-        // message to the function arguments.
-        if constexpr (view_type::is_const) {
-          if (msg.unique()) {
-            typename trait::mutable_message_view_type xs{msg};
-            do_invoke(xs);
-            return true;
-          }
+      };
+      using view_type = typename trait::message_view_type;
+      // If we have the only reference to a message, we can safely modify it
+      // in place, i.e., use the mutable view type and move values from the
+      // message to the function arguments.
+      if constexpr (view_type::is_const) {
+        if (msg.unique()) {
+          typename trait::mutable_message_view_type xs{msg};
+          do_invoke(xs);
+          return true;
         }
-        view_type xs{msg};
-        do_invoke(xs);
-        return true;
       }
-      return false;
-    };
-    return (dispatch(std::get<Is>(cases_)) || ...);
-  }
-
-  void handle_timeout() override {
-    timeout_definition_.handler();
+      view_type xs{msg};
+      do_invoke(xs);
+      return true;
+    }
   }
 
-private:
   tuple_type cases_;
 
   TimeoutDefinition timeout_definition_;
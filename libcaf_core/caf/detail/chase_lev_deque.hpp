@@ -0,0 +1,190 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/config.hpp"
+#include "caf/detail/assert.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace caf::detail {
+
+/// A lock-free, growable work-stealing deque as described by Chase and Lev in
+/// "Dynamic Circular Work-Stealing Deque" with the memory orderings from Lê et
+/// al. in "Correct and Efficient Work-Stealing for Weak Memory Models".
+///
+/// Only the owner of the deque may call `push` and `pop`, which operate on the
+/// bottom end in LIFO order. Any thread may call `steal` to take the oldest
+/// element from the top end. None of the operations allocates memory unless
+/// the owner pushes to a full deque, in which case the deque doubles its
+/// capacity. Previous buffers remain alive until the deque gets destroyed,
+/// because thieves may still read from them.
+template <class T>
+class chase_lev_deque {
+public:
+  // -- member types -----------------------------------------------------------
+
+  using value_type = T;
+
+  using pointer = value_type*;
+
+  // -- constants --------------------------------------------------------------
+
+  static constexpr size_t default_capacity = 1024;
+
+  // -- constructors, destructors, and assignment operators --------------------
+
+  explicit chase_lev_deque(size_t initial_capacity = default_capacity) {
+    // Round up to the next power of two to allow masking instead of modulo.
+    size_t capacity = 2;
+    while (capacity < initial_capacity)
+      capacity <<= 1;
+    buffers_.emplace_back(std::make_unique<buffer>(capacity));
+    buf_.store(buffers_.back().get(), std::memory_order_relaxed);
+  }
+
+  chase_lev_deque(const chase_lev_deque&) = delete;
+
+  chase_lev_deque& operator=(const chase_lev_deque&) = delete;
+
+  // -- properties -------------------------------------------------------------
+
+  /// Returns the current capacity of the deque.
+  /// @note Only the owner may call this function.
+  size_t capacity() const noexcept {
+    return buf_.load(std::memory_order_relaxed)->capacity();
+  }
+
+  /// Returns an approximation of the current size of the deque.
+  size_t size_hint() const noexcept {
+    auto b = bottom_.load(std::memory_order_relaxed);
+    auto t = top_.load(std::memory_order_relaxed);
+    return b > t ? static_cast<size_t>(b - t) : 0u;
+  }
+
+  /// Returns whether the deque appears to be empty.
+  bool empty_hint() const noexcept {
+    return size_hint() == 0;
+  }
+
+  // -- operations for the owner -----------------------------------------------
+
+  /// Pushes `value` to the bottom of the deque.
+  /// @note Only the owner may call this function.
+  void push(pointer value) {
+    CAF_ASSERT(value != nullptr);
+    auto b = bottom_.load(std::memory_order_relaxed);
+    auto t = top_.load(std::memory_order_acquire);
+    auto* buf = buf_.load(std::memory_order_relaxed);
+    if (b - t > static_cast<int64_t>(buf->capacity()) - 1)
+      buf = grow(buf, b, t);
+    buf->put(b, value);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(b + 1, std::memory_order_relaxed);
+  }
+
+  /// Pops the most recently pushed element from the bottom of the deque.
+  /// @returns the element or `nullptr` if the deque is empty.
+  /// @note Only the owner may call this function.
+  pointer pop() {
+    auto b = bottom_.load(std::memory_order_relaxed) - 1;
+    auto* buf = buf_.load(std::memory_order_relaxed);
+    bottom_.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto t = top_.load(std::memory_order_relaxed);
+    if (t > b) {
+      // Empty deque: restore the canonical empty state.
+      bottom_.store(b + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    auto* result = buf->get(b);
+    if (t == b) {
+      // Last element: race against thieves for it.
+      if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                        std::memory_order_relaxed))
+        result = nullptr;
+      bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+    return result;
+  }
+
+  // -- operations for thieves -------------------------------------------------
+
+  /// Takes the oldest element from the top of the deque.
+  /// @returns the element or `nullptr` if the deque is empty or if this thread
+  ///          lost a race against the owner or another thief.
+  /// @note Any thread may call this function.
+  pointer steal() {
+    auto t = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto b = bottom_.load(std::memory_order_acquire);
+    if (t >= b)
+      return nullptr;
+    auto* buf = buf_.load(std::memory_order_acquire);
+    auto* result = buf->get(t);
+    if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed))
+      return nullptr;
+    return result;
+  }
+
+private:
+  /// A circular array with a power-of-two capacity.
+  class buffer {
+  public:
+    explicit buffer(size_t capacity)
+      : mask_(capacity - 1), slots_(new std::atomic<pointer>[capacity]) {
+      // nop
+    }
+
+    size_t capacity() const noexcept {
+      return mask_ + 1;
+    }
+
+    pointer get(int64_t index) const noexcept {
+      return slots_[static_cast<size_t>(index) & mask_].load(
+        std::memory_order_relaxed);
+    }
+
+    void put(int64_t index, pointer value) noexcept {
+      slots_[static_cast<size_t>(index) & mask_].store(
+        value, std::memory_order_relaxed);
+    }
+
+  private:
+    size_t mask_;
+    std::unique_ptr<std::atomic<pointer>[]> slots_;
+  };
+
+  buffer* grow(buffer* old_buf, int64_t b, int64_t t) {
+    buffers_.emplace_back(std::make_unique<buffer>(old_buf->capacity() * 2));
+    auto* new_buf = buffers_.back().get();
+    for (auto i = t; i < b; ++i)
+      new_buf->put(i, old_buf->get(i));
+    buf_.store(new_buf, std::memory_order_release);
+    return new_buf;
+  }
+
+  /// Index of the oldest element, modified by thieves and by the owner when
+  /// racing for the last element.
+  alignas(CAF_CACHE_LINE_SIZE) std::atomic<int64_t> top_ = 0;
+
+  /// Index one past the newest element, only modified by the owner.
+  alignas(CAF_CACHE_LINE_SIZE) std::atomic<int64_t> bottom_ = 0;
+
+  /// Points to the currently active buffer.
+  std::atomic<buffer*> buf_ = nullptr;
+
+  /// Keeps all buffers alive until destruction, since thieves may still access
+  /// a previous buffer after the owner grew the deque. Only the owner accesses
+  /// this list.
+  std::vector<std::unique_ptr<buffer>> buffers_;
+};
+
+} // namespace caf::detail
@@ -0,0 +1,100 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/chase_lev_deque.hpp"
+
+#include "caf/test/test.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace caf;
+
+namespace {
+
+using int_deque = detail::chase_lev_deque<int>;
+
+} // namespace
+
+TEST("a default-constructed deque is empty") {
+  int_deque uut;
+  check(uut.empty_hint());
+  check_eq(uut.pop(), nullptr);
+  check_eq(uut.steal(), nullptr);
+}
+
+TEST("the owner pops elements in LIFO order") {
+  int xs[] = {1, 2, 3};
+  int_deque uut;
+  for (auto& x : xs)
+    uut.push(&x);
+  check_eq(uut.size_hint(), 3u);
+  check_eq(uut.pop(), &xs[2]);
+  check_eq(uut.pop(), &xs[1]);
+  check_eq(uut.pop(), &xs[0]);
+  check_eq(uut.pop(), nullptr);
+}
+
+TEST("thieves steal elements in FIFO order") {
+  int xs[] = {1, 2, 3};
+  int_deque uut;
+  for (auto& x : xs)
+    uut.push(&x);
+  check_eq(uut.steal(), &xs[0]);
+  check_eq(uut.steal(), &xs[1]);
+  check_eq(uut.pop(), &xs[2]);
+  check_eq(uut.steal(), nullptr);
+}
+
+TEST("the deque grows when pushing to a full buffer") {
+  std::vector<int> xs(100);
+  int_deque uut{8};
+  check_eq(uut.capacity(), 8u);
+  for (auto& x : xs)
+    uut.push(&x);
+  check_ge(uut.capacity(), 100u);
+  for (auto& x : xs)
+    check_eq(uut.steal(), &x);
+  check(uut.empty_hint());
+}
+
+TEST("each element is taken exactly once under concurrent stealing") {
+  constexpr int num_items = 100'000;
+  constexpr int num_thieves = 3;
+  std::vector<int> items(num_items);
+  std::vector<std::atomic<int>> taken(num_items);
+  int_deque uut{16};
+  std::atomic<bool> done = false;
+  std::atomic<int> total = 0;
+  auto consume = [&](int* ptr) {
+    taken[static_cast<size_t>(ptr - items.data())].fetch_add(1);
+    total.fetch_add(1);
+  };
+  std::vector<std::thread> thieves;
+  for (int i = 0; i < num_thieves; ++i)
+    thieves.emplace_back([&] {
+      while (!done.load())
+        if (auto* ptr = uut.steal())
+          consume(ptr);
+    });
+  for (auto& item : items) {
+    uut.push(&item);
+    // Pop every now and then to race against the thieves.
+    if ((&item - items.data()) % 3 == 0)
+      if (auto* ptr = uut.pop())
+        consume(ptr);
+  }
+  while (auto* ptr = uut.pop())
+    consume(ptr);
+  while (total.load() < num_items)
+    std::this_thread::yield();
+  done = true;
+  for (auto& thief : thieves)
+    thief.join();
+  check_eq(total.load(), num_items);
+  check(std::all_of(taken.begin(), taken.end(),
+                    [](const auto& x) { return x.load() == 1; }));
+}
@@ -8,8 +8,10 @@
 #include "caf/fwd.hpp"
 
 #include <array>
+#include <cstdint>
 #include <iterator>
 #include <optional>
+#include <ranges>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -288,6 +290,21 @@ template <class T>
 concept is_64bit_integer = std::is_same_v<T, int64_t>
                            || std::is_same_v<T, uint64_t>;
 
+/// Checks whether binary inspectors may process a contiguous range of `T` in a
+/// single pass, i.e., whether `T` is a fixed-size integer or floating point
+/// type.
+template <class T>
+concept is_bulk_binary_value
+  = one_of<T, int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t, int64_t,
+           uint64_t, float, double>;
+
+/// Checks whether `T` is a contiguous container of bulk binary values such as
+/// `std::vector<int32_t>`.
+template <class T>
+concept bulk_binary_list
+  = std::ranges::contiguous_range<T> && std::ranges::sized_range<T>
+    && is_bulk_binary_value<std::ranges::range_value_t<T>>;
+
 /// Checks whether `T` has a static member function called `init_host_system`.
 template <class T>
 concept has_init_host_system = requires {
@@ -0,0 +1,224 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/cpu_topology.hpp"
+
+#include "caf/config.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <set>
+#include <tuple>
+
+#ifdef CAF_LINUX
+#  include <sched.h>
+#endif
+
+namespace caf::detail {
+
+namespace {
+
+std::optional<std::string> read_line(const std::filesystem::path& path) {
+  std::ifstream in{path};
+  std::string line;
+  if (!in.is_open() || !std::getline(in, line))
+    return std::nullopt;
+  return line;
+}
+
+std::optional<size_t> read_size(const std::filesystem::path& path) {
+  if (auto line = read_line(path)) {
+    size_t result = 0;
+    auto* first = line->data();
+    auto* last = first + line->size();
+    auto [ptr, ec] = std::from_chars(first, last, result);
+    if (ec == std::errc{})
+      return result;
+  }
+  return std::nullopt;
+}
+
+// Returns the smallest CPU ID sharing the L3 cache with `cpu_dir` (if any).
+std::optional<size_t> read_l3_domain(const std::filesystem::path& cpu_dir) {
+  std::error_code err;
+  auto cache_dir = cpu_dir / "cache";
+  for (const auto& entry :
+       std::filesystem::directory_iterator{cache_dir, err}) {
+    if (!entry.path().filename().string().starts_with("index"))
+      continue;
+    if (read_size(entry.path() / "level") != 3)
+      continue;
+    if (auto line = read_line(entry.path() / "shared_cpu_list")) {
+      auto ids = parse_cpu_list(*line);
+      if (!ids.empty())
+        return *std::min_element(ids.begin(), ids.end());
+    }
+  }
+  return std::nullopt;
+}
+
+} // namespace
+
+std::vector<size_t> parse_cpu_list(std::string_view str) {
+  std::vector<size_t> result;
+  while (!str.empty() && (str.back() == '\n' || str.back() == ' '))
+    str.remove_suffix(1);
+  if (str.empty())
+    return result;
+  auto parse_id = [](std::string_view x, size_t& id) {
+    auto [ptr, ec] = std::from_chars(x.data(), x.data() + x.size(), id);
+    return ec == std::errc{} && ptr == x.data() + x.size();
+  };
+  for (;;) {
+    auto sep = str.find(',');
+    auto item = str.substr(0, sep);
+    size_t first = 0;
+    size_t last = 0;
+    if (auto dash = item.find('-'); dash != std::string_view::npos) {
+      if (!parse_id(item.substr(0, dash), first)
+          || !parse_id(item.substr(dash + 1), last) || last < first)
+        return {};
+    } else if (parse_id(item, first)) {
+      last = first;
+    } else {
+      return {};
+    }
+    for (auto id = first; id <= last; ++id)
+      result.push_back(id);
+    if (sep == std::string_view::npos)
+      return result;
+    str.remove_prefix(sep + 1);
+  }
+}
+
+cpu_topology cpu_topology::load() {
+#ifdef CAF_LINUX
+  if (auto allowed = allowed_cpus())
+    return load("/sys/devices/system", *allowed);
+  return load("/sys/devices/system");
+#else
+  return {};
+#endif
+}
+
+cpu_topology cpu_topology::load(const std::string& root) {
+  return load_impl(root, std::nullopt);
+}
+
+cpu_topology cpu_topology::load(const std::string& root,
+                                std::span<const size_t> allowed) {
+  return load_impl(root, allowed);
+}
+
+std::optional<std::vector<size_t>> cpu_topology::allowed_cpus() {
+#ifdef CAF_LINUX
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  if (sched_getaffinity(0, sizeof(cpu_set_t), &cpus) != 0)
+    return std::nullopt;
+  std::vector<size_t> result;
+  for (size_t id = 0; id < CPU_SETSIZE; ++id)
+    if (CPU_ISSET(id, &cpus))
+      result.push_back(id);
+  return result;
+#else
+  return std::nullopt;
+#endif
+}
+
+cpu_topology
+cpu_topology::load_impl(const std::string& root,
+                        std::optional<std::span<const size_t>> allowed) {
+  cpu_topology result;
+  auto root_dir = std::filesystem::path{root};
+  auto online = read_line(root_dir / "cpu" / "online");
+  if (!online)
+    return result;
+  // Map each CPU to its NUMA node. CPUs without a node default to node 0.
+  std::map<size_t, size_t> node_of;
+  std::error_code err;
+  for (const auto& entry :
+       std::filesystem::directory_iterator{root_dir / "node", err}) {
+    auto name = entry.path().filename().string();
+    if (!name.starts_with("node"))
+      continue;
+    size_t node_id = 0;
+    auto* first = name.data() + 4;
+    auto* last = name.data() + name.size();
+    if (auto [ptr, ec] = std::from_chars(first, last, node_id);
+        ec != std::errc{} || ptr != last)
+      continue;
+    if (auto line = read_line(entry.path() / "cpulist"))
+      for (auto id : parse_cpu_list(*line))
+        node_of[id] = node_id;
+  }
+  for (auto id : parse_cpu_list(*online)) {
+    // Skip CPUs outside of the affinity mask, because the OS refuses to run
+    // our threads there.
+    if (allowed && std::ranges::find(*allowed, id) == allowed->end())
+      continue;
+    auto cpu_dir = root_dir / "cpu" / ("cpu" + std::to_string(id));
+    cpu_info info;
+    info.id = id;
+    if (auto i = node_of.find(id); i != node_of.end())
+      info.node = i->second;
+    info.package = read_size(cpu_dir / "topology" / "physical_package_id")
+                     .value_or(0);
+    info.l3_domain = read_l3_domain(cpu_dir).value_or(info.package);
+    result.cpus_.push_back(info);
+  }
+  std::sort(result.cpus_.begin(), result.cpus_.end(),
+            [](const cpu_info& x, const cpu_info& y) {
+              return std::tie(x.node, x.l3_domain, x.id)
+                     < std::tie(y.node, y.l3_domain, y.id);
+            });
+  return result;
+}
+
+size_t cpu_topology::num_nodes() const noexcept {
+  std::set<size_t> nodes;
+  for (const auto& cpu : cpus_)
+    nodes.insert(cpu.node);
+  return nodes.size();
+}
+
+const cpu_info* cpu_topology::find(size_t cpu_id) const noexcept {
+  auto i = std::find_if(cpus_.begin(), cpus_.end(),
+                        [cpu_id](const cpu_info& x) { return x.id == cpu_id; });
+  return i != cpus_.end() ? &*i : nullptr;
+}
+
+size_t cpu_topology::distance(const cpu_info& x, const cpu_info& y) noexcept {
+  if (x.node != y.node)
+    return remote;
+  if (x.package == y.package && x.l3_domain == y.l3_domain)
+    return same_l3;
+  return same_node;
+}
+
+bool cpu_topology::pin_this_thread([[maybe_unused]] size_t cpu_id) {
+#ifdef CAF_LINUX
+  if (cpu_id >= CPU_SETSIZE)
+    return false;
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  CPU_SET(cpu_id, &cpus);
+  return sched_setaffinity(0, sizeof(cpu_set_t), &cpus) == 0;
+#else
+  return false;
+#endif
+}
+
+std::optional<size_t> cpu_topology::current_cpu() {
+#ifdef CAF_LINUX
+  if (auto id = sched_getcpu(); id >= 0)
+    return static_cast<size_t>(id);
+#endif
+  return std::nullopt;
+}
+
+} // namespace caf::detail
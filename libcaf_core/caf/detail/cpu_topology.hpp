@@ -0,0 +1,109 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/detail/core_export.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace caf::detail {
+
+/// Describes the location of a single logical CPU in the machine.
+struct cpu_info {
+  /// The logical CPU ID as used by the operating system.
+  size_t id = 0;
+
+  /// The NUMA node of the CPU.
+  size_t node = 0;
+
+  /// The physical package (socket) of the CPU.
+  size_t package = 0;
+
+  /// Identifies the L3 cache domain of the CPU by the smallest ID of all CPUs
+  /// sharing the same L3 cache.
+  size_t l3_domain = 0;
+};
+
+/// Stores the CPU layout of the machine as reported by the operating system.
+class CAF_CORE_EXPORT cpu_topology {
+public:
+  // -- constants --------------------------------------------------------------
+
+  /// Distance between two CPUs that share an L3 cache.
+  static constexpr size_t same_l3 = 0;
+
+  /// Distance between two CPUs on the same NUMA node.
+  static constexpr size_t same_node = 1;
+
+  /// Distance between two CPUs on different NUMA nodes.
+  static constexpr size_t remote = 2;
+
+  // -- factory functions ------------------------------------------------------
+
+  /// Reads the topology of the host, restricted to the CPUs in the affinity
+  /// mask of the calling thread. Returns an empty topology on platforms other
+  /// than Linux or if `/sys` is unavailable.
+  static cpu_topology load();
+
+  /// Reads the topology from a sysfs-like directory tree with the
+  /// subdirectories `cpu` and `node`, e.g., `/sys/devices/system`.
+  static cpu_topology load(const std::string& root);
+
+  /// Reads the topology from a sysfs-like directory tree but only includes
+  /// the CPUs in `allowed`.
+  static cpu_topology load(const std::string& root,
+                           std::span<const size_t> allowed);
+
+  /// Returns the IDs of all CPUs in the affinity mask of the calling thread,
+  /// e.g., as restricted by `taskset` or a cgroup cpuset. Returns `nullopt`
+  /// on platforms other than Linux or if the mask is unavailable.
+  static std::optional<std::vector<size_t>> allowed_cpus();
+
+  // -- properties -------------------------------------------------------------
+
+  /// Returns all online CPUs, ordered by node, L3 domain and ID.
+  const std::vector<cpu_info>& cpus() const noexcept {
+    return cpus_;
+  }
+
+  bool empty() const noexcept {
+    return cpus_.empty();
+  }
+
+  /// Returns the number of distinct NUMA nodes.
+  size_t num_nodes() const noexcept;
+
+  /// Returns the CPU with given ID or `nullptr` if no such CPU exists.
+  const cpu_info* find(size_t cpu_id) const noexcept;
+
+  /// Computes the distance between two CPUs.
+  static size_t distance(const cpu_info& x, const cpu_info& y) noexcept;
+
+  // -- thread placement -------------------------------------------------------
+
+  /// Binds the calling thread to the CPU with given ID.
+  /// @returns `true` on success, `false` otherwise.
+  static bool pin_this_thread(size_t cpu_id);
+
+  /// Returns the ID of the CPU that currently runs the calling thread.
+  static std::optional<size_t> current_cpu();
+
+private:
+  static cpu_topology load_impl(const std::string& root,
+                                std::optional<std::span<const size_t>> allowed);
+
+  std::vector<cpu_info> cpus_;
+};
+
+/// Parses a CPU list as used by Linux in sysfs, e.g., `0-3,8,10-11`.
+/// @returns the expanded list or an empty list on a parser error.
+CAF_CORE_EXPORT std::vector<size_t> parse_cpu_list(std::string_view str);
+
+} // namespace caf::detail
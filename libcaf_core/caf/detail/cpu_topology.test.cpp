@@ -0,0 +1,146 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/cpu_topology.hpp"
+
+#include "caf/test/scenario.hpp"
+#include "caf/test/test.hpp"
+
+#include "caf/config.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <thread>
+
+using namespace caf;
+
+namespace fs = std::filesystem;
+
+using ids = std::vector<size_t>;
+
+namespace {
+
+void write_file(const fs::path& path, std::string_view content) {
+  fs::create_directories(path.parent_path());
+  std::ofstream out{path};
+  out << content << '\n';
+}
+
+// Creates a fake sysfs tree for a dual-socket machine with 4 CPUs per socket,
+// one L3 cache per socket and one NUMA node per socket. The OS enumerates the
+// CPUs in interleaved order, i.e., even IDs are on node 0.
+fs::path make_fake_sysfs() {
+  auto root = fs::temp_directory_path() / "caf-cpu-topology-test";
+  fs::remove_all(root);
+  write_file(root / "cpu" / "online", "0-7");
+  for (int id = 0; id < 8; ++id) {
+    auto cpu_dir = root / "cpu" / ("cpu" + std::to_string(id));
+    auto package = std::to_string(id % 2);
+    write_file(cpu_dir / "topology" / "physical_package_id", package);
+    write_file(cpu_dir / "cache" / "index2" / "level", "2");
+    write_file(cpu_dir / "cache" / "index2" / "shared_cpu_list",
+               std::to_string(id));
+    write_file(cpu_dir / "cache" / "index3" / "level", "3");
+    write_file(cpu_dir / "cache" / "index3" / "shared_cpu_list",
+               id % 2 == 0 ? "0,2,4,6" : "1,3,5,7");
+  }
+  write_file(root / "node" / "node0" / "cpulist", "0,2,4,6");
+  write_file(root / "node" / "node1" / "cpulist", "1,3,5,7");
+  return root;
+}
+
+} // namespace
+
+TEST("parse_cpu_list expands ranges") {
+  using detail::parse_cpu_list;
+  check_eq(parse_cpu_list("0"), ids{0});
+  check_eq(parse_cpu_list("0-3"), ids({0, 1, 2, 3}));
+  check_eq(parse_cpu_list("0-1,4,6-7\n"), ids({0, 1, 4, 6, 7}));
+  check_eq(parse_cpu_list(""), ids{});
+  check_eq(parse_cpu_list("3-1"), ids{});
+  check_eq(parse_cpu_list("0,a"), ids{});
+}
+
+SCENARIO("cpu_topology reads the CPU layout from sysfs") {
+  GIVEN("a sysfs tree for a dual-socket machine") {
+    auto root = make_fake_sysfs();
+    WHEN("loading the topology") {
+      auto uut = detail::cpu_topology::load(root.string());
+      THEN("the CPUs are ordered by node and L3 domain") {
+        require_eq(uut.cpus().size(), 8u);
+        check_eq(uut.num_nodes(), 2u);
+        auto cpu_ids = ids{};
+        for (const auto& cpu : uut.cpus())
+          cpu_ids.push_back(cpu.id);
+        check_eq(cpu_ids, ids({0, 2, 4, 6, 1, 3, 5, 7}));
+      }
+      AND_THEN("each CPU knows its node, package and L3 domain") {
+        auto* cpu5 = uut.find(5);
+        require_ne(cpu5, nullptr);
+        check_eq(cpu5->node, 1u);
+        check_eq(cpu5->package, 1u);
+        check_eq(cpu5->l3_domain, 1u);
+        check_eq(uut.find(8), nullptr);
+      }
+      AND_THEN("the distance reflects shared caches and nodes") {
+        using detail::cpu_topology;
+        auto& cpu0 = *uut.find(0);
+        check_eq(cpu_topology::distance(cpu0, *uut.find(2)),
+                 cpu_topology::same_l3);
+        check_eq(cpu_topology::distance(cpu0, *uut.find(1)),
+                 cpu_topology::remote);
+      }
+    }
+    WHEN("loading the topology for a restricted affinity mask") {
+      auto allowed = ids({1, 2, 5, 9});
+      auto uut = detail::cpu_topology::load(root.string(), allowed);
+      THEN("the topology only contains online CPUs from the mask") {
+        auto cpu_ids = ids{};
+        for (const auto& cpu : uut.cpus())
+          cpu_ids.push_back(cpu.id);
+        check_eq(cpu_ids, ids({2, 1, 5}));
+        check_eq(uut.num_nodes(), 2u);
+        check_eq(uut.find(0), nullptr);
+      }
+    }
+    fs::remove_all(root);
+  }
+  GIVEN("a directory without CPU information") {
+    auto root = fs::temp_directory_path() / "caf-cpu-topology-test-empty";
+    fs::create_directories(root);
+    WHEN("loading the topology") {
+      auto uut = detail::cpu_topology::load(root.string());
+      THEN("the topology is empty") {
+        check(uut.empty());
+      }
+    }
+    fs::remove_all(root);
+  }
+}
+
+#ifdef CAF_LINUX
+
+TEST("cpu_topology only uses CPUs from the affinity mask") {
+  auto all = detail::cpu_topology::allowed_cpus();
+  require(all.has_value());
+  require(!all->empty());
+  // Restrict a new thread to a single CPU to emulate taskset or a cpuset.
+  auto cpu = all->back();
+  auto restricted = std::optional<ids>{};
+  auto topology = detail::cpu_topology{};
+  std::thread worker{[&] {
+    if (!detail::cpu_topology::pin_this_thread(cpu))
+      return;
+    restricted = detail::cpu_topology::allowed_cpus();
+    topology = detail::cpu_topology::load();
+  }};
+  worker.join();
+  require(restricted.has_value());
+  check_eq(*restricted, ids{cpu});
+  for (const auto& info : topology.cpus())
+    check_eq(info.id, cpu);
+}
+
+#endif // CAF_LINUX
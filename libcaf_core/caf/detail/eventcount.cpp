@@ -0,0 +1,46 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/eventcount.hpp"
+
+namespace caf::detail {
+
+eventcount::key_type eventcount::prepare_wait() noexcept {
+  waiters_.fetch_add(1, std::memory_order_seq_cst);
+  // Pairs with the fence in notify_one/notify_all: either the notifying thread
+  // observes the new waiter or the waiter observes the new state.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  return epoch_.load(std::memory_order_relaxed);
+}
+
+void eventcount::cancel_wait() noexcept {
+  waiters_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void eventcount::wait(key_type key) noexcept {
+  // std::atomic::wait may return spuriously, so we loop until the epoch
+  // actually changed.
+  while (epoch_.load(std::memory_order_acquire) == key)
+    epoch_.wait(key, std::memory_order_acquire);
+  waiters_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void eventcount::notify_one() noexcept {
+  // Pairs with the fence in prepare_wait.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (waiters_.load(std::memory_order_relaxed) == 0)
+    return;
+  epoch_.fetch_add(1, std::memory_order_release);
+  epoch_.notify_one();
+}
+
+void eventcount::notify_all() noexcept {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (waiters_.load(std::memory_order_relaxed) == 0)
+    return;
+  epoch_.fetch_add(1, std::memory_order_release);
+  epoch_.notify_all();
+}
+
+} // namespace caf::detail
@@ -0,0 +1,62 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/config.hpp"
+#include "caf/detail/core_export.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace caf::detail {
+
+/// Allows threads to wait for a condition that other threads may change
+/// without holding a lock. Waiting happens in three steps:
+///
+/// 1. Call `prepare_wait` to obtain a key.
+/// 2. Re-check the condition. If it holds, call `cancel_wait` and stop.
+/// 3. Call `wait` with the key to block until a notification arrives.
+///
+/// Notifying is cheap when no thread is waiting: `notify_one` and `notify_all`
+/// only perform a single atomic load in this case. Blocking uses
+/// `std::atomic::wait`, which maps to a futex on Linux.
+class CAF_CORE_EXPORT eventcount {
+public:
+  using key_type = uint32_t;
+
+  eventcount() = default;
+
+  eventcount(const eventcount&) = delete;
+
+  eventcount& operator=(const eventcount&) = delete;
+
+  /// Announces that the calling thread is about to wait.
+  key_type prepare_wait() noexcept;
+
+  /// Reverts a previous call to `prepare_wait`.
+  void cancel_wait() noexcept;
+
+  /// Blocks the calling thread until another thread calls `notify_one` or
+  /// `notify_all` after the call to `prepare_wait` that returned `key`.
+  void wait(key_type key) noexcept;
+
+  /// Wakes up one waiting thread if at least one thread is waiting.
+  void notify_one() noexcept;
+
+  /// Wakes up all waiting threads.
+  void notify_all() noexcept;
+
+  /// Returns the number of threads that called `prepare_wait` without calling
+  /// `cancel_wait` or `wait` afterwards.
+  size_t waiters() const noexcept {
+    return waiters_.load(std::memory_order_relaxed);
+  }
+
+private:
+  alignas(CAF_CACHE_LINE_SIZE) std::atomic<key_type> epoch_ = 0;
+  std::atomic<uint32_t> waiters_ = 0;
+};
+
+} // namespace caf::detail
@@ -0,0 +1,78 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/eventcount.hpp"
+
+#include "caf/test/test.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace caf;
+
+TEST("notifying without waiters has no effect") {
+  detail::eventcount uut;
+  uut.notify_one();
+  uut.notify_all();
+  check_eq(uut.waiters(), 0u);
+}
+
+TEST("cancel_wait reverts prepare_wait") {
+  detail::eventcount uut;
+  uut.prepare_wait();
+  check_eq(uut.waiters(), 1u);
+  uut.cancel_wait();
+  check_eq(uut.waiters(), 0u);
+}
+
+TEST("waiting returns immediately after a notification") {
+  detail::eventcount uut;
+  auto key = uut.prepare_wait();
+  uut.notify_one();
+  uut.wait(key);
+  check_eq(uut.waiters(), 0u);
+}
+
+TEST("waiters never miss a state change") {
+  constexpr int num_items = 10'000;
+  constexpr int num_consumers = 3;
+  detail::eventcount uut;
+  std::atomic<int> available = 0;
+  std::atomic<int> consumed = 0;
+  auto try_take = [&] {
+    auto n = available.load();
+    while (n > 0)
+      if (available.compare_exchange_weak(n, n - 1))
+        return true;
+    return false;
+  };
+  std::vector<std::thread> consumers;
+  for (int i = 0; i < num_consumers; ++i)
+    consumers.emplace_back([&] {
+      for (;;) {
+        if (consumed.load() >= num_items)
+          return;
+        if (try_take()) {
+          if (consumed.fetch_add(1) + 1 == num_items)
+            uut.notify_all();
+          continue;
+        }
+        auto key = uut.prepare_wait();
+        if (available.load() > 0 || consumed.load() >= num_items) {
+          uut.cancel_wait();
+          continue;
+        }
+        uut.wait(key);
+      }
+    });
+  for (int i = 0; i < num_items; ++i) {
+    available.fetch_add(1);
+    uut.notify_one();
+  }
+  for (auto& consumer : consumers)
+    consumer.join();
+  check_eq(consumed.load(), num_items);
+  check_eq(uut.waiters(), 0u);
+}
@@ -142,4 +142,19 @@ typename ieee_754_trait<T>::float_type unpack754(T i) {
   return result;
 }
 
+/// Checks whether the packed value `i` represents a normal number, i.e., has
+/// an exponent that is neither all zeros nor all ones. For normal numbers, the
+/// output of `pack754` is identical to the native IEEE 754 representation.
+/// Callers must fall back to `pack754` for all other numbers. Note that
+/// `pack754` does not preserve subnormal numbers, i.e., they do not survive a
+/// round trip through `pack754` and `unpack754`.
+template <class T>
+constexpr bool is_normal754(T i) noexcept {
+  using trait = ieee_754_trait<T>;
+  constexpr auto significandbits = trait::bits - trait::expbits - 1;
+  constexpr auto mask = ((T{1} << trait::expbits) - 1) << significandbits;
+  auto exponent = i & mask;
+  return exponent != 0 && exponent != mask;
+}
+
 } // namespace caf::detail
@@ -7,6 +7,7 @@
 #include "caf/allowed_unsafe_message_type.hpp"
 #include "caf/binary_deserializer.hpp"
 #include "caf/binary_serializer.hpp"
+#include "caf/binary_size_calculator.hpp"
 #include "caf/deserializer.hpp"
 #include "caf/detail/meta_object.hpp"
 #include "caf/detail/padded_size.hpp"
@@ -50,6 +51,11 @@ bool load_binary(binary_deserializer& source, void* ptr) {
   return source.apply(*static_cast<T*>(ptr));
 }
 
+template <class T>
+bool binary_size(binary_size_calculator& sink, const void* ptr) {
+  return sink.apply(*static_cast<const T*>(ptr));
+}
+
 template <class T>
 bool save(serializer& sink, const void* ptr) {
   return sink.apply(*static_cast<const T*>(ptr));
@@ -88,6 +94,7 @@ meta_object make_meta_object(std::string_view type_name) {
     default_function::move_construct<T>,
     default_function::save_binary<T>,
     default_function::load_binary<T>,
+    default_function::binary_size<T>,
     default_function::save<T>,
     default_function::load<T>,
     default_function::stringify<T>,
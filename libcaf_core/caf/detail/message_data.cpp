@@ -5,6 +5,7 @@
 #include "caf/detail/message_data.hpp"
 
 #include "caf/detail/assert.hpp"
+#include "caf/detail/message_pool.hpp"
 #include "caf/detail/meta_object.hpp"
 #include "caf/error.hpp"
 #include "caf/error_code.hpp"
@@ -13,12 +14,19 @@
 #include "caf/sec.hpp"
 
 #include <cstring>
+#include <new>
 #include <numeric>
 
 namespace caf::detail {
 
 message_data::message_data(type_id_list types) noexcept
-  : rc_(1), types_(std::move(types)), constructed_elements_(0) {
+  : message_data(types, types.offsets()) {
+  // nop
+}
+
+message_data::message_data(type_id_list types, const size_t* offsets) noexcept
+  : rc_(1), types_(std::move(types)), offsets_(offsets),
+    constructed_elements_(0) {
   // nop
 }
 
@@ -43,14 +51,12 @@ message_data* message_data::copy() const {
   // Note: no need to perform bound checks or nullptr checks here, because
   //       we verify the type IDs while constructing the original message.
   auto gmos = global_meta_objects();
-  size_t storage_size = 0;
-  for (auto id : types_)
-    storage_size += gmos[id].padded_size;
-  auto total_size = sizeof(message_data) + storage_size;
-  auto vptr = malloc(total_size);
+  auto total_size = sizeof(message_data) + offsets_[types_.size()];
+  auto vptr = allocate(total_size);
   if (vptr == nullptr)
     CAF_RAISE_ERROR(std::bad_alloc, "bad_alloc");
-  intrusive_ptr<message_data> ptr{new (vptr) message_data(types_), adopt_ref};
+  intrusive_ptr<message_data> ptr{new (vptr) message_data(types_, offsets_),
+                                  adopt_ref};
   auto src = storage();
   auto dst = ptr->storage();
   for (auto id : types_) {
@@ -65,34 +71,28 @@ message_data* message_data::copy() const {
 
 intrusive_ptr<message_data>
 message_data::make_uninitialized(type_id_list types) {
-  size_t storage_size = 0;
-  for (auto id : types)
-    storage_size += global_meta_object(id).padded_size;
-  auto total_size = sizeof(message_data) + storage_size;
-  auto vptr = malloc(total_size);
+  auto offsets = types.offsets();
+  auto total_size = sizeof(message_data) + offsets[types.size()];
+  auto vptr = allocate(total_size);
   if (vptr == nullptr)
     CAF_RAISE_ERROR(std::bad_alloc, "bad_alloc");
-  return {new (vptr) message_data(types), adopt_ref};
+  return {new (vptr) message_data(types, offsets), adopt_ref};
 }
 
-std::byte* message_data::at(size_t index) noexcept {
-  if (index == 0)
-    return storage();
-  auto gmos = global_meta_objects();
-  auto ptr = storage();
-  for (size_t i = 0; i < index; ++i)
-    ptr += gmos[types_[i]].padded_size;
-  return ptr;
+void* message_data::allocate(size_t size) noexcept {
+#ifdef CAF_ENABLE_MESSAGE_POOL
+  return message_pool::allocate(size);
+#else
+  return ::operator new(size, std::nothrow);
+#endif
 }
 
-const std::byte* message_data::at(size_t index) const noexcept {
-  if (index == 0)
-    return storage();
-  auto gmos = global_meta_objects();
-  auto ptr = storage();
-  for (size_t i = 0; i < index; ++i)
-    ptr += gmos[types_[i]].padded_size;
-  return ptr;
+void message_data::deallocate(void* ptr) noexcept {
+#ifdef CAF_ENABLE_MESSAGE_POOL
+  message_pool::deallocate(ptr);
+#else
+  ::operator delete(ptr);
+#endif
 }
 
 std::byte* message_data::stepwise_init_from(std::byte* pos,
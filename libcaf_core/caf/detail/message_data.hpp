@@ -43,12 +43,28 @@ public:
   /// Constructs the message data object *without* constructing any element.
   explicit message_data(type_id_list types) noexcept;
 
+  /// Constructs the message data object *without* constructing any element.
+  /// @param types The type IDs of the message elements.
+  /// @param offsets The offset table for `types`, e.g., from `offset_table`.
+  message_data(type_id_list types, const size_t* offsets) noexcept;
+
   ~message_data() noexcept;
 
   message_data* copy() const;
 
   static intrusive_ptr<message_data> make_uninitialized(type_id_list types);
 
+  // -- memory management ------------------------------------------------------
+
+  /// Allocates `size` bytes for a message data object, i.e., `size` includes
+  /// `sizeof(message_data)`. Uses the message pool if CAF was built with
+  /// `CAF_ENABLE_MESSAGE_POOL`.
+  /// @returns a pointer to the allocated memory or `nullptr` on error.
+  static void* allocate(size_t size) noexcept;
+
+  /// Releases memory that was previously allocated with `allocate`.
+  static void deallocate(void* ptr) noexcept;
+
   // -- reference counting -----------------------------------------------------
 
   /// Increases reference count by one.
@@ -61,7 +77,7 @@ public:
   void deref() noexcept {
     if (unique() || rc_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
       this->~message_data();
-      free(const_cast<message_data*>(this));
+      deallocate(const_cast<message_data*>(this));
     }
   }
 
@@ -99,10 +115,14 @@ public:
 
   /// Returns the memory location for the object at given index.
   /// @pre `index < size()`
-  std::byte* at(size_t index) noexcept;
+  std::byte* at(size_t index) noexcept {
+    return storage_ + offsets_[index];
+  }
 
   /// @copydoc at
-  const std::byte* at(size_t index) const noexcept;
+  const std::byte* at(size_t index) const noexcept {
+    return storage_ + offsets_[index];
+  }
 
   void inc_constructed_elements() {
     ++constructed_elements_;
@@ -183,6 +203,7 @@ private:
 
   mutable std::atomic<size_t> rc_;
   type_id_list types_;
+  const size_t* offsets_;
   size_t constructed_elements_;
   alignas(max_align_t) std::byte storage_[];
 };
@@ -0,0 +1,166 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/detail/assert.hpp"
+#include "caf/message_id.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace caf::detail {
+
+/// An open-addressing hash map with linear probing that maps message IDs to
+/// values. Erasing an element shifts subsequent elements of the same probe
+/// sequence backwards instead of leaving tombstones, so lookups never need to
+/// skip deleted slots.
+/// @note The map uses the message ID with integer value 0 as marker for empty
+///       slots. Hence, keys must have a non-zero integer value.
+template <class T>
+class message_id_map {
+public:
+  // -- member types -----------------------------------------------------------
+
+  using mapped_type = T;
+
+  // -- constants --------------------------------------------------------------
+
+  /// Number of slots that the map allocates on first insertion.
+  static constexpr size_t min_capacity = 16;
+
+  // -- properties -------------------------------------------------------------
+
+  /// Returns the number of stored elements.
+  size_t size() const noexcept {
+    return size_;
+  }
+
+  /// Returns whether the map contains no elements.
+  bool empty() const noexcept {
+    return size_ == 0;
+  }
+
+  // -- lookup -----------------------------------------------------------------
+
+  /// Returns a pointer to the value for `id` or `nullptr` if no such value
+  /// exists.
+  mapped_type* find(message_id id) noexcept {
+    if (auto pos = position_of(id.integer_value()); pos != npos)
+      return &slots_[pos].value;
+    return nullptr;
+  }
+
+  // -- modifiers --------------------------------------------------------------
+
+  /// Adds `value` for `id` unless the map already contains a value for `id`.
+  /// @returns `true` if the map stored `value`, `false` otherwise.
+  bool emplace(message_id id, mapped_type value) {
+    auto key = id.integer_value();
+    CAF_ASSERT(key != 0);
+    // Keep the load factor at or below 50% to keep probe sequences short.
+    if ((size_ + 1) * 2 > slots_.size())
+      grow();
+    for (auto pos = home_of(key);; pos = next(pos)) {
+      auto& slot = slots_[pos];
+      if (slot.key == key)
+        return false;
+      if (slot.key == 0) {
+        slot.key = key;
+        slot.value = std::move(value);
+        ++size_;
+        return true;
+      }
+    }
+  }
+
+  /// Removes the value for `id` from the map and returns it.
+  std::optional<mapped_type> take(message_id id) {
+    auto pos = position_of(id.integer_value());
+    if (pos == npos)
+      return std::nullopt;
+    std::optional<mapped_type> result{std::move(slots_[pos].value)};
+    erase_at(pos);
+    return result;
+  }
+
+  /// Removes all elements from the map.
+  void clear() noexcept {
+    slots_.clear();
+    size_ = 0;
+  }
+
+private:
+  static constexpr size_t npos = static_cast<size_t>(-1);
+
+  struct slot {
+    uint64_t key = 0;
+    mapped_type value;
+  };
+
+  size_t home_of(uint64_t key) const noexcept {
+    // Fibonacci hashing spreads the sequential request IDs over all slots.
+    auto hash = key * uint64_t{0x9E3779B97F4A7C15};
+    return static_cast<size_t>(hash >> 32) & (slots_.size() - 1);
+  }
+
+  size_t next(size_t pos) const noexcept {
+    return (pos + 1) & (slots_.size() - 1);
+  }
+
+  size_t position_of(uint64_t key) const noexcept {
+    if (size_ == 0)
+      return npos;
+    for (auto pos = home_of(key);; pos = next(pos)) {
+      auto slot_key = slots_[pos].key;
+      if (slot_key == key)
+        return pos;
+      if (slot_key == 0)
+        return npos;
+    }
+  }
+
+  void erase_at(size_t pos) {
+    // Shift elements backwards until reaching an empty slot or an element
+    // that already sits in its home slot.
+    auto gap = pos;
+    for (auto i = next(gap);; i = next(i)) {
+      auto& candidate = slots_[i];
+      if (candidate.key == 0)
+        break;
+      auto home = home_of(candidate.key);
+      // Move the candidate into the gap unless its home lies cyclically in
+      // the range (gap, i].
+      auto in_range = gap <= i ? (gap < home && home <= i)
+                               : (gap < home || home <= i);
+      if (!in_range) {
+        slots_[gap].key = candidate.key;
+        slots_[gap].value = std::move(candidate.value);
+        gap = i;
+      }
+    }
+    slots_[gap].key = 0;
+    slots_[gap].value = mapped_type{};
+    --size_;
+  }
+
+  void grow() {
+    auto new_capacity = slots_.empty() ? min_capacity : slots_.size() * 2;
+    std::vector<slot> old_slots(new_capacity);
+    old_slots.swap(slots_);
+    size_ = 0;
+    for (auto& x : old_slots)
+      if (x.key != 0)
+        emplace(message_id{x.key}, std::move(x.value));
+  }
+
+  std::vector<slot> slots_;
+
+  size_t size_ = 0;
+};
+
+} // namespace caf::detail
@@ -0,0 +1,103 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/message_id_map.hpp"
+
+#include "caf/test/test.hpp"
+
+#include <string>
+
+using namespace caf;
+using namespace std::literals;
+
+namespace {
+
+using map_type = detail::message_id_map<std::string>;
+
+message_id req(uint64_t id) {
+  return make_message_id(id).response_id();
+}
+
+} // namespace
+
+TEST("a default-constructed map is empty") {
+  map_type uut;
+  check(uut.empty());
+  check_eq(uut.size(), 0u);
+  check_eq(uut.find(req(1)), nullptr);
+  check(!uut.take(req(1)).has_value());
+}
+
+TEST("emplace adds new elements only") {
+  map_type uut;
+  check(uut.emplace(req(1), "one"s));
+  check(uut.emplace(req(2), "two"s));
+  check(!uut.emplace(req(1), "uno"s));
+  check_eq(uut.size(), 2u);
+  if (auto* ptr = uut.find(req(1)); check_ne(ptr, nullptr))
+    check_eq(*ptr, "one");
+  if (auto* ptr = uut.find(req(2)); check_ne(ptr, nullptr))
+    check_eq(*ptr, "two");
+  check_eq(uut.find(req(3)), nullptr);
+}
+
+TEST("take removes elements from the map") {
+  map_type uut;
+  uut.emplace(req(1), "one"s);
+  uut.emplace(req(2), "two"s);
+  check_eq(uut.take(req(1)), "one"s);
+  check_eq(uut.size(), 1u);
+  check_eq(uut.find(req(1)), nullptr);
+  check(!uut.take(req(1)).has_value());
+  check_eq(uut.take(req(2)), "two"s);
+  check(uut.empty());
+}
+
+TEST("the map grows on demand and keeps all elements") {
+  map_type uut;
+  for (uint64_t id = 1; id <= 1000; ++id)
+    check(uut.emplace(req(id), std::to_string(id)));
+  check_eq(uut.size(), 1000u);
+  auto all_found = true;
+  for (uint64_t id = 1; id <= 1000; ++id) {
+    auto* ptr = uut.find(req(id));
+    if (ptr == nullptr || *ptr != std::to_string(id))
+      all_found = false;
+  }
+  check(all_found);
+}
+
+TEST("erasing elements keeps the remaining elements reachable") {
+  map_type uut;
+  for (uint64_t id = 1; id <= 500; ++id)
+    uut.emplace(req(id), std::to_string(id));
+  SECTION("erasing in order of insertion") {
+    for (uint64_t id = 1; id <= 500; id += 2)
+      check_eq(uut.take(req(id)), std::to_string(id));
+  }
+  SECTION("erasing in reverse order of insertion") {
+    for (auto id = 499; id > 0; id -= 2)
+      check_eq(uut.take(req(static_cast<uint64_t>(id))), std::to_string(id));
+  }
+  check_eq(uut.size(), 250u);
+  auto all_ok = true;
+  for (uint64_t id = 1; id <= 500; ++id) {
+    auto* ptr = uut.find(req(id));
+    if (id % 2 == 1 ? ptr != nullptr
+                    : ptr == nullptr || *ptr != std::to_string(id))
+      all_ok = false;
+  }
+  check(all_ok);
+}
+
+TEST("clear removes all elements") {
+  map_type uut;
+  for (uint64_t id = 1; id <= 100; ++id)
+    uut.emplace(req(id), std::to_string(id));
+  uut.clear();
+  check(uut.empty());
+  check_eq(uut.find(req(1)), nullptr);
+  check(uut.emplace(req(1), "one"s));
+  check_eq(uut.size(), 1u);
+}
@@ -0,0 +1,278 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/message_pool.hpp"
+
+#include "caf/detail/assert.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace caf::detail {
+
+namespace {
+
+class thread_cache;
+
+/// Precedes each block and stores where to return the block to.
+struct block_header {
+  /// Points to the cache that allocated this block or is `nullptr` if the
+  /// block bypasses the cache.
+  thread_cache* owner;
+
+  /// Stores the size class of the block.
+  size_t size_class;
+};
+
+/// Size of the block header, padded to keep user memory properly aligned.
+constexpr size_t header_size = alignof(std::max_align_t) >= sizeof(block_header)
+                                 ? alignof(std::max_align_t)
+                                 : 2 * alignof(std::max_align_t);
+
+static_assert(sizeof(block_header) <= header_size);
+
+/// Overlays a block while it sits in a free list.
+struct free_node {
+  free_node* next;
+};
+
+/// Marks a return list of a cache that currently has no owning thread.
+free_node* const closed = reinterpret_cast<free_node*>(uintptr_t{1});
+
+constexpr size_t block_size(size_t size_class) noexcept {
+  return message_pool::min_block_size << size_class;
+}
+
+/// Holds the free lists for one thread.
+class thread_cache {
+public:
+  thread_cache() {
+    for (auto& head : remote_)
+      head.store(nullptr, std::memory_order_relaxed);
+  }
+
+  /// Takes a block from the local free list, refilling it from the return
+  /// list or from the system if necessary.
+  block_header* allocate(size_t size_class) noexcept {
+    auto& xs = local_[size_class];
+    if (xs.head == nullptr) {
+      auto* node = remote_[size_class].exchange(nullptr,
+                                                std::memory_order_acquire);
+      while (node != nullptr) {
+        auto* next = node->next;
+        node->next = xs.head;
+        xs.head = node;
+        ++xs.size;
+        node = next;
+      }
+    }
+    void* block = nullptr;
+    if (xs.head != nullptr) {
+      block = xs.head;
+      xs.head = xs.head->next;
+      --xs.size;
+    } else {
+      block = ::operator new(block_size(size_class), std::nothrow);
+      if (block == nullptr)
+        return nullptr;
+    }
+    return new (block) block_header{this, size_class};
+  }
+
+  /// Returns a block to the local free list. Only the owning thread may call
+  /// this function.
+  void release_local(block_header* hdr) noexcept {
+    auto& xs = local_[hdr->size_class];
+    if (xs.size >= message_pool::max_cached_blocks) {
+      ::operator delete(hdr);
+      return;
+    }
+    auto* node = new (hdr) free_node{xs.head};
+    xs.head = node;
+    ++xs.size;
+  }
+
+  /// Returns a block to the return list. Any thread may call this function.
+  void release_remote(block_header* hdr) noexcept {
+    auto& head = remote_[hdr->size_class];
+    auto* node = new (hdr) free_node{nullptr};
+    auto* next = head.load(std::memory_order_relaxed);
+    do {
+      if (next == closed) {
+        ::operator delete(node);
+        return;
+      }
+      node->next = next;
+    } while (!head.compare_exchange_weak(next, node, std::memory_order_release,
+                                         std::memory_order_relaxed));
+  }
+
+  /// Prepares the cache for a new owning thread.
+  void open() noexcept {
+    for (auto& head : remote_)
+      head.store(nullptr, std::memory_order_relaxed);
+  }
+
+  /// Returns all cached blocks to the system and closes the return lists.
+  /// Afterwards, other threads release blocks of this cache directly.
+  void close() noexcept {
+    auto release_all = [](free_node* node) {
+      while (node != nullptr) {
+        auto* next = node->next;
+        ::operator delete(node);
+        node = next;
+      }
+    };
+    for (auto& xs : local_) {
+      release_all(xs.head);
+      xs.head = nullptr;
+      xs.size = 0;
+    }
+    for (auto& head : remote_)
+      release_all(head.exchange(closed, std::memory_order_acquire));
+  }
+
+  size_t cached_blocks(size_t size_class) const noexcept {
+    return local_[size_class].size;
+  }
+
+private:
+  struct free_list {
+    free_node* head = nullptr;
+    size_t size = 0;
+  };
+
+  /// Free lists of the owning thread.
+  std::array<free_list, message_pool::num_size_classes> local_;
+
+  /// Blocks that other threads returned to this cache.
+  std::array<std::atomic<free_node*>, message_pool::num_size_classes> remote_;
+};
+
+/// Keeps caches of terminated threads for reuse. Blocks store a pointer to
+/// their cache, so caches must remain valid for the lifetime of the process.
+class cache_registry {
+public:
+  thread_cache* acquire() {
+    std::unique_lock guard{mtx_};
+    if (idle_.empty()) {
+      guard.unlock();
+      return new thread_cache;
+    }
+    auto* result = idle_.back();
+    idle_.pop_back();
+    guard.unlock();
+    result->open();
+    return result;
+  }
+
+  void release(thread_cache* ptr) {
+    ptr->close();
+    std::unique_lock guard{mtx_};
+    idle_.push_back(ptr);
+  }
+
+  static cache_registry& instance() {
+    // Intentionally leaked: threads may still return blocks during static
+    // destruction.
+    static auto* result = new cache_registry;
+    return *result;
+  }
+
+private:
+  std::mutex mtx_;
+  std::vector<thread_cache*> idle_;
+};
+
+/// Binds a cache to the lifetime of the current thread.
+class cache_handle {
+public:
+  ~cache_handle() {
+    if (ptr_ != nullptr) {
+      auto* ptr = ptr_;
+      ptr_ = nullptr;
+      cache_registry::instance().release(ptr);
+    }
+    destroyed_ = true;
+  }
+
+  /// Returns the cache of the current thread, creating it on first use, or
+  /// `nullptr` if the thread is shutting down.
+  thread_cache* get() {
+    if (ptr_ == nullptr && !destroyed_)
+      ptr_ = cache_registry::instance().acquire();
+    return ptr_;
+  }
+
+  /// Returns the cache of the current thread without creating it.
+  thread_cache* peek() const noexcept {
+    return ptr_;
+  }
+
+private:
+  thread_cache* ptr_ = nullptr;
+  bool destroyed_ = false;
+};
+
+thread_local cache_handle this_thread_cache;
+
+block_header* header_of(void* ptr) noexcept {
+  return reinterpret_cast<block_header*>(static_cast<std::byte*>(ptr)
+                                         - header_size);
+}
+
+void* user_memory(block_header* hdr) noexcept {
+  return reinterpret_cast<std::byte*>(hdr) + header_size;
+}
+
+} // namespace
+
+void* message_pool::allocate(size_t size) noexcept {
+  auto cls = size_class(size);
+  if (cls < num_size_classes) {
+    if (auto* cache = this_thread_cache.get()) {
+      if (auto* hdr = cache->allocate(cls))
+        return user_memory(hdr);
+      return nullptr;
+    }
+  }
+  auto* vptr = ::operator new(header_size + size, std::nothrow);
+  if (vptr == nullptr)
+    return nullptr;
+  return user_memory(new (vptr) block_header{nullptr, num_size_classes});
+}
+
+void message_pool::deallocate(void* ptr) noexcept {
+  if (ptr == nullptr)
+    return;
+  auto* hdr = header_of(ptr);
+  auto* owner = hdr->owner;
+  if (owner == nullptr)
+    ::operator delete(hdr);
+  else if (owner == this_thread_cache.peek())
+    owner->release_local(hdr);
+  else
+    owner->release_remote(hdr);
+}
+
+size_t message_pool::size_class(size_t size) noexcept {
+  auto total = header_size + size;
+  for (size_t cls = 0; cls < num_size_classes; ++cls)
+    if (total <= block_size(cls))
+      return cls;
+  return num_size_classes;
+}
+
+size_t message_pool::cached_blocks(size_t size_class) noexcept {
+  CAF_ASSERT(size_class < num_size_classes);
+  if (auto* cache = this_thread_cache.peek())
+    return cache->cached_blocks(size_class);
+  return 0;
+}
+
+} // namespace caf::detail
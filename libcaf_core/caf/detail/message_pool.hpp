@@ -0,0 +1,57 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/detail/core_export.hpp"
+
+#include <cstddef>
+
+namespace caf::detail {
+
+/// Caching allocator for the objects that CAF allocates for each message, i.e.,
+/// mailbox elements and message data. Each thread keeps one free list per size
+/// class and serves allocations from its free lists without synchronization.
+/// Releasing a block on a different thread pushes the block to a lock-free
+/// return list of the thread that allocated it. The owning thread collects
+/// returned blocks once its local free list runs empty.
+///
+/// Requests that exceed the largest size class bypass the cache.
+/// @note CAF only uses this allocator if it was built with
+///       `CAF_ENABLE_MESSAGE_POOL`.
+class CAF_CORE_EXPORT message_pool {
+public:
+  // -- constants --------------------------------------------------------------
+
+  /// Number of distinct size classes.
+  static constexpr size_t num_size_classes = 6;
+
+  /// Size of the smallest size class in bytes.
+  static constexpr size_t min_block_size = 64;
+
+  /// Maximum number of blocks per size class in a local free list. Releasing
+  /// a block to a full free list returns the block to the system.
+  static constexpr size_t max_cached_blocks = 256;
+
+  // -- allocation -------------------------------------------------------------
+
+  /// Allocates at least `size` bytes, aligned to `alignof(std::max_align_t)`.
+  /// @returns a pointer to the allocated memory or `nullptr` on error.
+  static void* allocate(size_t size) noexcept;
+
+  /// Releases memory that was previously allocated with `allocate`.
+  static void deallocate(void* ptr) noexcept;
+
+  // -- properties -------------------------------------------------------------
+
+  /// Returns the size class for an allocation of `size` bytes or
+  /// `num_size_classes` if the allocation bypasses the cache.
+  static size_t size_class(size_t size) noexcept;
+
+  /// Returns the number of cached blocks in the free list of the calling
+  /// thread for given size class.
+  static size_t cached_blocks(size_t size_class) noexcept;
+};
+
+} // namespace caf::detail
@@ -0,0 +1,91 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/message_pool.hpp"
+
+#include "caf/test/test.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace caf;
+
+using detail::message_pool;
+
+namespace {
+
+bool is_aligned(void* ptr) {
+  return reinterpret_cast<uintptr_t>(ptr) % alignof(std::max_align_t) == 0;
+}
+
+} // namespace
+
+TEST("small allocations map to size classes") {
+  check_eq(message_pool::size_class(1), 0u);
+  check_eq(message_pool::size_class(1024), 5u);
+  check_eq(message_pool::size_class(1024 * 1024),
+           message_pool::num_size_classes);
+}
+
+TEST("released blocks are reused by the same thread") {
+  auto cls = message_pool::size_class(40);
+  auto* ptr1 = message_pool::allocate(40);
+  require(ptr1 != nullptr);
+  check(is_aligned(ptr1));
+  auto cached = message_pool::cached_blocks(cls);
+  message_pool::deallocate(ptr1);
+  check_eq(message_pool::cached_blocks(cls), cached + 1);
+  auto* ptr2 = message_pool::allocate(40);
+  check_eq(ptr1, ptr2);
+  check_eq(message_pool::cached_blocks(cls), cached);
+  message_pool::deallocate(ptr2);
+}
+
+TEST("large blocks bypass the cache") {
+  auto* ptr = message_pool::allocate(1024 * 1024);
+  require(ptr != nullptr);
+  check(is_aligned(ptr));
+  message_pool::deallocate(ptr);
+  message_pool::deallocate(nullptr);
+}
+
+TEST("blocks released by other threads return to their owner") {
+  // Use a new thread to start with empty free lists.
+  auto cls = message_pool::size_class(100);
+  auto cached_before = size_t{0};
+  auto cached_after = size_t{0};
+  std::thread{[&] {
+    std::vector<void*> blocks;
+    for (int i = 0; i < 10; ++i)
+      blocks.push_back(message_pool::allocate(100));
+    std::thread{[&blocks] {
+      for (auto* ptr : blocks)
+        message_pool::deallocate(ptr);
+    }}.join();
+    cached_before = message_pool::cached_blocks(cls);
+    // Draining the return list moves all blocks to the local free list.
+    auto* ptr = message_pool::allocate(100);
+    cached_after = message_pool::cached_blocks(cls);
+    message_pool::deallocate(ptr);
+  }}.join();
+  check_eq(cached_before, 0u);
+  check_eq(cached_after, 9u);
+}
+
+TEST("blocks may outlive the thread that allocated them") {
+  std::vector<void*> blocks;
+  std::thread{[&blocks] {
+    for (int i = 0; i < 10; ++i)
+      blocks.push_back(message_pool::allocate(200));
+  }}.join();
+  for (auto* ptr : blocks)
+    message_pool::deallocate(ptr);
+  // Starting a new thread recycles the cache of the terminated thread.
+  std::thread{[] {
+    auto* ptr = message_pool::allocate(200);
+    message_pool::deallocate(ptr);
+  }}.join();
+}
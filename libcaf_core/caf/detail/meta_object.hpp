@@ -48,6 +48,9 @@ struct meta_object {
   /// Applies an object to a binary deserializer.
   bool (*load_binary)(caf::binary_deserializer&, void*);
 
+  /// Applies an object to a binary size calculator.
+  bool (*binary_size)(caf::binary_size_calculator&, const void*);
+
   /// Applies an object to a generic serializer.
   bool (*save)(caf::serializer&, const void*);
 
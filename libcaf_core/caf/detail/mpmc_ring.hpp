@@ -0,0 +1,126 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/config.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace caf::detail {
+
+/// A bounded, lock-free queue for any number of producers and consumers based
+/// on the algorithm by Dmitry Vyukov. Each slot carries a sequence number that
+/// tells producers and consumers whether the slot is ready for them, so that
+/// each operation only needs a single CAS on the shared index in the common
+/// case.
+template <class T>
+class mpmc_ring {
+public:
+  static_assert(std::is_nothrow_copy_assignable_v<T>,
+                "mpmc_ring requires nothrow copy-assignable values");
+
+  // -- member types -----------------------------------------------------------
+
+  using value_type = T;
+
+  // -- constructors, destructors, and assignment operators --------------------
+
+  explicit mpmc_ring(size_t min_capacity) {
+    // Round up to the next power of two to allow masking instead of modulo.
+    size_t capacity = 2;
+    while (capacity < min_capacity)
+      capacity <<= 1;
+    mask_ = capacity - 1;
+    cells_.reset(new cell[capacity]);
+    for (size_t i = 0; i < capacity; ++i)
+      cells_[i].seq.store(i, std::memory_order_relaxed);
+  }
+
+  mpmc_ring(const mpmc_ring&) = delete;
+
+  mpmc_ring& operator=(const mpmc_ring&) = delete;
+
+  // -- properties -------------------------------------------------------------
+
+  size_t capacity() const noexcept {
+    return mask_ + 1;
+  }
+
+  /// Returns whether the queue appears to be empty.
+  bool empty_hint() const noexcept {
+    return head_.load(std::memory_order_relaxed)
+           >= tail_.load(std::memory_order_relaxed);
+  }
+
+  // -- modifiers --------------------------------------------------------------
+
+  /// Tries to append `value` to the queue.
+  /// @returns `false` if the queue is full, `true` otherwise.
+  bool try_push(const value_type& value) noexcept {
+    auto pos = tail_.load(std::memory_order_relaxed);
+    for (;;) {
+      auto& slot = cells_[pos & mask_];
+      auto seq = slot.seq.load(std::memory_order_acquire);
+      auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+      if (diff == 0) {
+        if (tail_.compare_exchange_weak(pos, pos + 1,
+                                        std::memory_order_relaxed)) {
+          slot.value = value;
+          slot.seq.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = tail_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /// Tries to remove the oldest element from the queue.
+  /// @returns `false` if the queue is empty, `true` otherwise.
+  bool try_pop(value_type& result) noexcept {
+    auto pos = head_.load(std::memory_order_relaxed);
+    for (;;) {
+      auto& slot = cells_[pos & mask_];
+      auto seq = slot.seq.load(std::memory_order_acquire);
+      auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+      if (diff == 0) {
+        if (head_.compare_exchange_weak(pos, pos + 1,
+                                        std::memory_order_relaxed)) {
+          result = slot.value;
+          slot.seq.store(pos + mask_ + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = head_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+private:
+  struct cell {
+    std::atomic<size_t> seq;
+    value_type value;
+  };
+
+  /// Position of the next element to pop.
+  alignas(CAF_CACHE_LINE_SIZE) std::atomic<size_t> head_ = 0;
+
+  /// Position for the next element to push.
+  alignas(CAF_CACHE_LINE_SIZE) std::atomic<size_t> tail_ = 0;
+
+  alignas(CAF_CACHE_LINE_SIZE) size_t mask_ = 0;
+
+  std::unique_ptr<cell[]> cells_;
+};
+
+} // namespace caf::detail
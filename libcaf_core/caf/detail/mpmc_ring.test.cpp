@@ -0,0 +1,79 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/mpmc_ring.hpp"
+
+#include "caf/test/test.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+using namespace caf;
+
+TEST("the capacity is rounded up to the next power of two") {
+  detail::mpmc_ring<int> uut{5};
+  check_eq(uut.capacity(), 8u);
+}
+
+TEST("elements leave the ring in FIFO order") {
+  detail::mpmc_ring<int> uut{4};
+  check(uut.empty_hint());
+  for (int i = 0; i < 4; ++i)
+    check(uut.try_push(i));
+  check(!uut.try_push(4));
+  for (int i = 0; i < 4; ++i) {
+    auto value = -1;
+    check(uut.try_pop(value));
+    check_eq(value, i);
+  }
+  auto value = -1;
+  check(!uut.try_pop(value));
+  check(uut.empty_hint());
+}
+
+TEST("the ring wraps around") {
+  detail::mpmc_ring<int> uut{4};
+  for (int i = 0; i < 100; ++i) {
+    check(uut.try_push(i));
+    auto value = -1;
+    check(uut.try_pop(value));
+    check_eq(value, i);
+  }
+}
+
+TEST("each element is taken exactly once with many producers and consumers") {
+  constexpr int num_threads = 3;
+  constexpr int items_per_producer = 20'000;
+  detail::mpmc_ring<int> uut{64};
+  std::vector<std::vector<int>> results(num_threads);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < num_threads; ++i)
+    threads.emplace_back([&uut, i] {
+      for (int n = 0; n < items_per_producer; ++n)
+        while (!uut.try_push(i * items_per_producer + n))
+          std::this_thread::yield();
+    });
+  for (int i = 0; i < num_threads; ++i)
+    threads.emplace_back([&uut, &results, i] {
+      auto& xs = results[i];
+      while (xs.size() < items_per_producer) {
+        auto value = 0;
+        if (uut.try_pop(value))
+          xs.push_back(value);
+        else
+          std::this_thread::yield();
+      }
+    });
+  for (auto& t : threads)
+    t.join();
+  std::vector<int> all;
+  for (auto& xs : results)
+    all.insert(all.end(), xs.begin(), xs.end());
+  std::sort(all.begin(), all.end());
+  check_eq(all.size(), static_cast<size_t>(num_threads * items_per_producer));
+  for (size_t i = 0; i < all.size(); ++i)
+    if (!check_eq(all[i], static_cast<int>(i)))
+      break;
+}
@@ -6,6 +6,9 @@
 
 #include "caf/detail/padded_size.hpp"
 
+#include <array>
+#include <cstddef>
+
 namespace caf::detail {
 
 template <size_t Remaining, class T, class... Ts>
@@ -22,4 +25,20 @@ struct offset_at_helper<0, T, Ts...> {
 template <size_t Index, class... Ts>
 constexpr size_t offset_at = offset_at_helper<Index, Ts...>::value;
 
+/// Computes the byte offset of each element in a type-erased tuple for `Ts`,
+/// followed by the total size of the tuple.
+template <class... Ts>
+constexpr std::array<size_t, sizeof...(Ts) + 1> make_offset_table() noexcept {
+  std::array<size_t, sizeof...(Ts) + 1> result{};
+  size_t sizes[] = {padded_size_v<Ts>..., 0};
+  for (size_t index = 0; index < sizeof...(Ts); ++index)
+    result[index + 1] = result[index] + sizes[index];
+  return result;
+}
+
+/// Stores the result of `make_offset_table<Ts...>()`. Same layout as the
+/// tables returned by `offset_table`, but computed at compile time.
+template <class... Ts>
+inline constexpr auto offset_table_v = make_offset_table<Ts...>();
+
 } // namespace caf::detail
@@ -0,0 +1,133 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/offset_table.hpp"
+
+#include "caf/detail/meta_object.hpp"
+#include "caf/type_id_list.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace caf::detail {
+
+namespace {
+
+using key_type = type_id_list::pointer;
+
+/// Number of slots in the lock-free part of the cache.
+constexpr size_t num_slots = 4096;
+
+/// Maximum number of slots to probe before falling back to the overflow map.
+constexpr size_t max_probes = 16;
+
+struct slot {
+  std::atomic<key_type> key;
+  std::atomic<const size_t*> offsets;
+};
+
+slot slots[num_slots];
+
+std::mutex overflow_mtx;
+
+std::unordered_map<key_type, std::unique_ptr<size_t[]>> overflow;
+
+size_t slot_index(key_type key) noexcept {
+  auto x = reinterpret_cast<uintptr_t>(key) / alignof(type_id_t);
+  x ^= x >> 12;
+  return static_cast<size_t>(x) % num_slots;
+}
+
+/// Computes a new offset table or returns `nullptr` if `Strict` is `false` and
+/// a meta object is missing.
+template <bool Strict>
+size_t* compute(type_id_list types) {
+  auto result = std::make_unique<size_t[]>(types.size() + 1);
+  auto offset = size_t{0};
+  for (size_t index = 0; index < types.size(); ++index) {
+    result[index] = offset;
+    if constexpr (Strict) {
+      offset += global_meta_object(types[index]).padded_size;
+    } else {
+      auto meta = global_meta_object_or_null(types[index]);
+      if (meta == nullptr)
+        return nullptr;
+      offset += meta->padded_size;
+    }
+  }
+  result[types.size()] = offset;
+  return result.release();
+}
+
+const size_t* await_offsets(slot& entry) noexcept {
+  // Another thread claimed the slot and is about to store the table.
+  auto* result = entry.offsets.load(std::memory_order_acquire);
+  while (result == nullptr) {
+    std::this_thread::yield();
+    result = entry.offsets.load(std::memory_order_acquire);
+  }
+  return result;
+}
+
+const size_t* find(key_type key) noexcept {
+  auto first = slot_index(key);
+  for (size_t i = 0; i < max_probes; ++i) {
+    auto& entry = slots[(first + i) % num_slots];
+    auto entry_key = entry.key.load(std::memory_order_acquire);
+    if (entry_key == key)
+      return await_offsets(entry);
+    if (entry_key == nullptr)
+      return nullptr;
+  }
+  std::unique_lock guard{overflow_mtx};
+  if (auto i = overflow.find(key); i != overflow.end())
+    return i->second.get();
+  return nullptr;
+}
+
+/// Adds `offsets` to the cache. Returns the previous table and deletes
+/// `offsets` if another thread added a table for `key` in the meantime.
+const size_t* insert(key_type key, size_t* offsets) noexcept {
+  auto first = slot_index(key);
+  for (size_t i = 0; i < max_probes; ++i) {
+    auto& entry = slots[(first + i) % num_slots];
+    auto entry_key = entry.key.load(std::memory_order_acquire);
+    if (entry_key == nullptr
+        && entry.key.compare_exchange_strong(entry_key, key,
+                                             std::memory_order_acq_rel)) {
+      entry.offsets.store(offsets, std::memory_order_release);
+      return offsets;
+    }
+    if (entry_key == key) {
+      delete[] offsets;
+      return await_offsets(entry);
+    }
+  }
+  std::unique_lock guard{overflow_mtx};
+  auto [iter, added] = overflow.try_emplace(key, offsets);
+  if (!added)
+    delete[] offsets;
+  return iter->second.get();
+}
+
+} // namespace
+
+const size_t* offset_table(type_id_list types) noexcept {
+  if (auto* result = find(types.data()))
+    return result;
+  return insert(types.data(), compute<true>(types));
+}
+
+void precompute_offset_table(type_id_list types) noexcept {
+  if (find(types.data()) != nullptr)
+    return;
+  if (auto* offsets = compute<false>(types))
+    insert(types.data(), offsets);
+}
+
+} // namespace caf::detail
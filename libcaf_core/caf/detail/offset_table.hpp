@@ -0,0 +1,27 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/detail/core_export.hpp"
+#include "caf/fwd.hpp"
+
+#include <cstddef>
+
+namespace caf::detail {
+
+/// Returns the offset table for `types`. The table stores the byte offset of
+/// each element in a type-erased tuple for the types in `types`, followed by
+/// the total size of the tuple. CAF computes the table once per list and
+/// caches it with the address of the list as key.
+/// @pre `types` has static storage duration, i.e., it was created with
+///      `make_type_id_list` or by a `type_id_list_builder`.
+CAF_CORE_EXPORT const size_t* offset_table(type_id_list types) noexcept;
+
+/// Computes the offset table for `types` ahead of time unless the cache
+/// already contains an entry for `types` or if some types in the list have no
+/// meta object yet.
+CAF_CORE_EXPORT void precompute_offset_table(type_id_list types) noexcept;
+
+} // namespace caf::detail
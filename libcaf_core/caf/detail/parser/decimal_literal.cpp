@@ -0,0 +1,141 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/parser/decimal_literal.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <iterator>
+#include <limits>
+#include <system_error>
+
+// Converting decimal numbers with std::from_chars is correctly rounded and
+// recent standard libraries implement it with the Eisel-Lemire algorithm.
+// Older versions of libc++ do not support floating point numbers, though.
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#  define CAF_HAS_FLOATING_POINT_FROM_CHARS
+#endif
+
+namespace caf::detail::parser {
+
+namespace {
+
+// Powers of ten that have an exact representation as float or double.
+template <class T>
+struct exact_powers_of_ten;
+
+template <>
+struct exact_powers_of_ten<float> {
+  static constexpr float values[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f,
+                                     1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+};
+
+template <>
+struct exact_powers_of_ten<double> {
+  static constexpr double values[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                      1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                      1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                      1e18, 1e19, 1e20, 1e21, 1e22};
+};
+
+// Largest integer that converts to T without rounding.
+template <class T>
+constexpr uint64_t max_exact_int = uint64_t{1}
+                                   << std::numeric_limits<T>::digits;
+
+} // namespace
+
+void decimal_literal::assign(uint64_t x) noexcept {
+  mantissa_ = 0;
+  size_ = 0;
+  dropped_ = 0;
+  sticky_ = false;
+  if (x == 0)
+    return;
+  auto res = std::to_chars(digits_, digits_ + max_digits, x);
+  size_ = static_cast<size_t>(res.ptr - digits_);
+  mantissa_ = x;
+}
+
+template <class T>
+T decimal_literal::to_impl(int exp) const noexcept {
+  if (size_ == 0)
+    return 0;
+  exp += dropped_;
+  // Fast path (Clinger): if the mantissa as well as the power of ten are
+  // exact, a single multiplication or division rounds correctly.
+  if (size_ <= max_mantissa_digits && mantissa_ <= max_exact_int<T>) {
+    const auto& powers = exact_powers_of_ten<T>::values;
+    constexpr auto max_exp = static_cast<int>(std::size(powers)) - 1;
+    auto x = static_cast<T>(mantissa_);
+    if (exp < 0) {
+      if (exp >= -max_exp)
+        return x / powers[-exp];
+    } else if (exp <= max_exp) {
+      return x * powers[exp];
+    } else {
+      // Move excess zeros into the mantissa as long as it remains exact,
+      // e.g., 12e24 becomes 1200e22 for double.
+      auto m = mantissa_;
+      auto e = exp;
+      for (; e > max_exp && m <= max_exact_int<T> / 10; --e)
+        m *= 10;
+      if (e <= max_exp)
+        return static_cast<T>(m) * powers[e];
+    }
+  }
+#ifdef CAF_HAS_FLOATING_POINT_FROM_CHARS
+  // Slow path: render the digits in scientific notation and let the standard
+  // library compute the nearest value.
+  char buf[max_digits + 16];
+  auto* last = std::copy_n(digits_, size_, buf);
+  if (sticky_) {
+    // Any non-zero digit after the last stored digit suffices for rounding.
+    *last++ = '1';
+    --exp;
+  }
+  *last++ = 'e';
+  last = std::to_chars(last, buf + sizeof(buf), exp).ptr;
+  T result = 0;
+  auto res = std::from_chars(buf, last, result);
+  if (res.ec == std::errc::result_out_of_range) {
+    if (exp + static_cast<int>(size_) > 0)
+      return std::numeric_limits<T>::infinity();
+    return 0;
+  }
+  return result;
+#else
+  // Fallback for standard libraries without floating point support in
+  // from_chars: scale the first digits by a power of ten. Not correctly
+  // rounded for all inputs.
+  static constexpr double power_table[] = {1e1,  1e2,  1e4,   1e8,  1e16,
+                                           1e32, 1e64, 1e128, 1e256};
+  if (size_ > max_mantissa_digits)
+    exp += static_cast<int>(size_ - max_mantissa_digits);
+  // Anything beyond this range is zero or infinity anyway.
+  exp = std::clamp(exp, -511, 511);
+  auto result = static_cast<double>(mantissa_);
+  auto i = 0;
+  if (exp < 0) {
+    for (auto n = -exp; n != 0; n >>= 1, ++i)
+      if (n & 0x01)
+        result /= power_table[i];
+  } else {
+    for (auto n = exp; n != 0; n >>= 1, ++i)
+      if (n & 0x01)
+        result *= power_table[i];
+  }
+  return static_cast<T>(result);
+#endif
+}
+
+double decimal_literal::to_double(int exp) const noexcept {
+  return to_impl<double>(exp);
+}
+
+float decimal_literal::to_float(int exp) const noexcept {
+  return to_impl<float>(exp);
+}
+
+} // namespace caf::detail::parser
@@ -0,0 +1,86 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/detail/core_export.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace caf::detail::parser {
+
+/// Collects the significant digits of a decimal number for converting it to
+/// the nearest floating point value. Leading zeros are not significant and
+/// the decimal point is tracked by the caller as a decimal exponent.
+class CAF_CORE_EXPORT decimal_literal {
+public:
+  /// Maximum number of digits we store. A `double` never requires more than
+  /// 767 significant digits for correct rounding, so storing more digits than
+  /// that plus a sticky bit for the remainder is sufficient.
+  static constexpr size_t max_digits = 800;
+
+  /// Maximum number of digits that always fit into the 64-bit mantissa.
+  static constexpr size_t max_mantissa_digits = 19;
+
+  /// Appends the decimal digit `c`.
+  void push_back(char c) noexcept {
+    if (c == '0' && size_ == 0)
+      return;
+    if (size_ < max_digits) {
+      if (size_ < max_mantissa_digits)
+        mantissa_ = mantissa_ * 10 + static_cast<uint64_t>(c - '0');
+      digits_[size_++] = c;
+    } else {
+      ++dropped_;
+      sticky_ |= c != '0';
+    }
+  }
+
+  /// Returns the number of significant digits, including digits that did not
+  /// fit into the buffer.
+  int num_digits() const noexcept {
+    return static_cast<int>(size_) + dropped_;
+  }
+
+  /// Replaces the digits with the decimal representation of `x`.
+  void assign(uint64_t x) noexcept;
+
+  /// Returns the `double` closest to `digits * 10^exp`.
+  double to_double(int exp) const noexcept;
+
+  /// Returns the `float` closest to `digits * 10^exp`.
+  float to_float(int exp) const noexcept;
+
+  /// Dispatches to `to_double` or `to_float` based on `T`.
+  template <class T>
+  T to(int exp) const noexcept {
+    if constexpr (std::is_same_v<T, float>)
+      return to_float(exp);
+    else
+      return static_cast<T>(to_double(exp));
+  }
+
+private:
+  template <class T>
+  T to_impl(int exp) const noexcept;
+
+  /// Stores the value of the first `max_mantissa_digits` digits.
+  uint64_t mantissa_ = 0;
+
+  /// Number of digits in `digits_`.
+  size_t size_ = 0;
+
+  /// Number of digits that did not fit into `digits_`.
+  int dropped_ = 0;
+
+  /// Signals whether any of the dropped digits was not zero.
+  bool sticky_ = false;
+
+  /// Stores the significant digits (not null-terminated).
+  char digits_[max_digits];
+};
+
+} // namespace caf::detail::parser
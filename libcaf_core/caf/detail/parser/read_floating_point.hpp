@@ -7,9 +7,11 @@
 #include "caf/config.hpp"
 #include "caf/detail/parser/add_ascii.hpp"
 #include "caf/detail/parser/chars.hpp"
+#include "caf/detail/parser/decimal_literal.hpp"
 #include "caf/detail/parser/sub_ascii.hpp"
 #include "caf/pec.hpp"
 
+#include <cstdint>
 #include <optional>
 #include <type_traits>
 
@@ -19,34 +21,18 @@ CAF_PUSH_UNUSED_LABEL_WARNING
 
 namespace caf::detail::parser {
 
-/// Reads a floating point number (`float` or `double`).
-/// @param ps The parser state.
-/// @param consumer Sink for generated values.
-/// @param start_value Allows another parser to pre-initialize this parser with
-///                    the pre-decimal value.
-template <class State, class Consumer, class ValueType>
+/// Reads a floating point number (`float` or `double`) with the significant
+/// digits in `digits`, which may contain the integer part if another parser
+/// pre-initialized this parser.
+template <class ValueType, class State, class Consumer>
 void read_floating_point(State& ps, Consumer&& consumer,
-                         std::optional<ValueType> start_value,
-                         bool negative = false) {
-  // Any exponent larger than 511 always overflows.
+                         decimal_literal& digits, bool has_start_value,
+                         bool negative) {
+  // Any number with a magnitude beyond 10^511 always overflows.
   constexpr int max_double_exponent = 511;
   // We assume a simple integer until proven wrong.
   enum sign_t { plus, minus };
-  sign_t sign;
-  ValueType result;
-  if (!start_value) {
-    sign = plus;
-    result = 0;
-  } else if (*start_value < 0) {
-    sign = minus;
-    result = -*start_value;
-  } else if (negative) {
-    sign = minus;
-    result = *start_value;
-  } else {
-    sign = plus;
-    result = *start_value;
-  }
+  sign_t sign = negative ? minus : plus;
   // Adjusts our mantissa, e.g., 1.23 becomes 123 with a dec_exp of -2.
   auto dec_exp = 0;
   // Exponent part of a floating point literal.
@@ -54,13 +40,13 @@ void read_floating_point(State& ps, Consumer&& consumer,
   // Reads the a decimal place.
   auto rd_decimal = [&](char c) {
     --dec_exp;
-    return add_ascii<10>(result, c);
+    digits.push_back(c);
   };
   // clang-format off
   // Definition of our parser FSM.
   start();
   unstable_state(init) {
-    epsilon_if(!start_value, regular_init)
+    epsilon_if(!has_start_value, regular_init)
     epsilon(after_dec, "eE.")
     epsilon(after_dot, any_char)
   }
@@ -81,8 +67,7 @@ void read_floating_point(State& ps, Consumer&& consumer,
   }
   // Reads the integer part of the mantissa or a positive decimal integer.
   term_state(dec) {
-    transition(dec, decimal_chars, add_ascii<10>(result, ch),
-               pec::integer_overflow)
+    transition(dec, decimal_chars, digits.push_back(ch))
     epsilon(after_dec, "eE.")
   }
   state(after_dec) {
@@ -91,7 +76,7 @@ void read_floating_point(State& ps, Consumer&& consumer,
   }
   // ".", "+.", etc. aren't valid numbers, so this state isn't terminal.
   state(leading_dot) {
-    transition(after_dot, decimal_chars, rd_decimal(ch), pec::exponent_underflow)
+    transition(after_dot, decimal_chars, rd_decimal(ch))
   }
   // "1." is a valid number, so a trailing dot is a terminal state.
   term_state(trailing_dot) {
@@ -99,7 +84,7 @@ void read_floating_point(State& ps, Consumer&& consumer,
   }
   // Read the decimal part of a mantissa.
   term_state(after_dot) {
-    transition(after_dot, decimal_chars, rd_decimal(ch), pec::exponent_underflow)
+    transition(after_dot, decimal_chars, rd_decimal(ch))
     transition(has_e, "eE")
   }
   // "...e", "...e+", and "...e-" aren't valid numbers, so these states are not
@@ -135,31 +120,63 @@ void read_floating_point(State& ps, Consumer&& consumer,
   // Compute final floating point number.
   // 1) Fix the exponent.
   exp += dec_exp;
-  // 2) Check whether exponent is in valid range.
-  if (exp < -max_double_exponent) {
-    ps.code = pec::exponent_underflow;
+  // 2) Check whether the number is in valid range. The magnitude depends on
+  //    the position of the leading significant digit, e.g., "3." followed by
+  //    520 decimal places has an exponent of -520 but is still about 3.
+  if (auto n = digits.num_digits(); n > 0) {
+    auto magnitude = exp + n;
+    if (magnitude < -max_double_exponent) {
+      ps.code = pec::exponent_underflow;
+      return;
+    }
+    if (magnitude > max_double_exponent) {
+      ps.code = pec::exponent_overflow;
+      return;
+    }
+  }
+  // 3) Compute the nearest value and call consumer.
+  auto result = digits.template to<ValueType>(exp);
+  consumer.value(sign == plus ? result : -result);
+}
+
+/// Reads a floating point number (`float` or `double`).
+/// @param ps The parser state.
+/// @param consumer Sink for generated values.
+/// @param start_value Allows another parser to pre-initialize this parser with
+///                    the pre-decimal value.
+template <class State, class Consumer, class ValueType>
+void read_floating_point(State& ps, Consumer&& consumer,
+                         std::optional<ValueType> start_value,
+                         bool negative = false) {
+  // Collects the significant digits for computing a correctly rounded result
+  // only once at the end.
+  decimal_literal digits;
+  if (!start_value) {
+    read_floating_point<ValueType>(ps, consumer, digits, false, false);
     return;
   }
-  if (exp > max_double_exponent) {
-    ps.code = pec::exponent_overflow;
-    return;
+  auto integer_part = *start_value;
+  if (integer_part < 0) {
+    negative = true;
+    integer_part = -integer_part;
   }
-  // 3) Scale result.
-  // Pre-computed powers of 10 for the scaling loop.
-  static double powerTable[] = {1e1,  1e2,  1e4,   1e8,  1e16,
-                                1e32, 1e64, 1e128, 1e256};
-  auto i = 0;
-  if (exp < 0) {
-    for (auto n = -exp; n != 0; n >>= 1, ++i)
-      if (n & 0x01)
-        result /= static_cast<ValueType>(powerTable[i]);
-  } else {
-    for (auto n = exp; n != 0; n >>= 1, ++i)
-      if (n & 0x01)
-        result *= static_cast<ValueType>(powerTable[i]);
-  }
-  // 4) Fix sign and call consumer.
-  consumer.value(sign == plus ? result : -result);
+  digits.assign(static_cast<uint64_t>(integer_part));
+  read_floating_point<ValueType>(ps, consumer, digits, true, negative);
+}
+
+/// Reads a `double` after another parser consumed the pre-decimal value.
+/// Unlike passing the pre-decimal value as `double`, this overload keeps all
+/// of its digits for rounding correctly.
+/// @param ps The parser state.
+/// @param consumer Sink for generated values.
+/// @param integer_part The absolute pre-decimal value.
+/// @param negative Signals whether the number has a leading minus sign.
+template <class State, class Consumer>
+void read_floating_point(State& ps, Consumer&& consumer, uint64_t integer_part,
+                         bool negative = false) {
+  decimal_literal digits;
+  digits.assign(integer_part);
+  read_floating_point<double>(ps, consumer, digits, true, negative);
 }
 
 template <class State, class Consumer>
@@ -8,6 +8,8 @@
 
 #include "caf/parser_state.hpp"
 
+#include <limits>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <variant>
@@ -26,6 +28,25 @@ struct double_consumer {
   double x;
 };
 
+// The decimal representation of the value halfway between 1e300 and the next
+// larger double.
+constexpr std::string_view halfway_after_1e300
+  = "1000000000000000126855605679093573388607593488603187161478864198481525"
+    "4107775011615834042331006665413021201686407014076668787127450090830983"
+    "7405446203199237238991625604630709288637225616778178719368944494985764"
+    "3457040908156539501183462088086674146902434205806252960993440370942179"
+    "392028053726841274368";
+
+struct float_consumer {
+  using value_type = float;
+
+  void value(float y) {
+    x = y;
+  }
+
+  float x;
+};
+
 std::optional<double> read(std::string_view str) {
   double_consumer consumer;
   string_parser_state ps{str.begin(), str.end()};
@@ -86,3 +107,68 @@ TEST("scientific noation") {
   check_eq(read("+12e-3"), 12e-3);
   check_eq(read("-12e-3"), -12e-3);
 }
+
+TEST("the parser rounds to the nearest floating point number") {
+  check_eq(read("0.1"), 0.1);
+  check_eq(read("0.3"), 0.3);
+  check_eq(read("1.7976931348623157e308"), 1.7976931348623157e308);
+  check_eq(read("2.2250738585072014e-308"), 2.2250738585072014e-308);
+  check_eq(read("4.9406564584124654e-324"), 4.9406564584124654e-324);
+  check_eq(read("123456789012345678901234567890"), 1.2345678901234568e29);
+  check_eq(read("3.14159265358979323846264338327950288"), 3.141592653589793);
+  check_eq(read("0.1000000000000000055511151231257827021181583404541015625"),
+           0.1);
+  // Exactly halfway between two doubles: rounds to even.
+  check_eq(read("9007199254740993"), 9007199254740992.);
+  check_eq(read("9007199254740995"), 9007199254740996.);
+  // Slightly above the halfway point: rounds up.
+  check_eq(read("9007199254740993.0000000001"), 9007199254740994.);
+}
+
+TEST("the parser rounds correctly after dropping excess digits") {
+  // One digit followed by more zeros than the parser stores.
+  auto str = "1" + std::string(809, '0') + "e-511";
+  check_eq(read(str), 1e298);
+  // Exactly halfway between 1e300 and the next double: rounds to even.
+  str = std::string{halfway_after_1e300};
+  check_eq(read(str), 1e300);
+  // A non-zero digit beyond the stored digits still affects rounding.
+  str += "." + std::string(499, '0') + "1";
+  check_eq(read(str), 1.0000000000000002e300);
+}
+
+TEST("the parser accepts long fractional parts") {
+  // The exponent alone is out of range, but the number is not.
+  auto str = "3." + std::string(520, '1');
+  check_eq(read(str), 3.111111111111111);
+  str = "0." + std::string(600, '0') + "1" + std::string(99, '0') + "e600";
+  check_eq(read(str), 1e-1);
+  str = "1" + std::string(899, '1') + "e-600";
+  check_eq(read(str), 1.1111111111111112e299);
+  // Numbers with a magnitude beyond 10^511 remain errors.
+  check(!read("1e512"));
+  check(!read("0." + std::string(600, '0') + "1"));
+}
+
+TEST("the parser returns zero or infinity for numbers out of range") {
+  check_eq(read("1e-400"), 0.);
+  check_eq(read("-1e-400"), -0.);
+  check_eq(read("1e400"), std::numeric_limits<double>::infinity());
+  check_eq(read("-1e400"), -std::numeric_limits<double>::infinity());
+}
+
+TEST("the parser rounds to the nearest float for float consumers") {
+  auto read_float = [](std::string_view str) -> std::optional<float> {
+    float_consumer consumer;
+    string_parser_state ps{str.begin(), str.end()};
+    detail::parser::read_floating_point(ps, consumer);
+    if (ps.code != pec::success)
+      return std::nullopt;
+    return consumer.x;
+  };
+  check_eq(read_float("0.1"), 0.1f);
+  check_eq(read_float("16777217"), 16777216.f);
+  check_eq(read_float("3.4028235e38"), 3.4028235e38f);
+  check_eq(read_float("1.4e-45"), 1.4e-45f);
+  check_eq(read_float("1e39"), std::numeric_limits<float>::infinity());
+}
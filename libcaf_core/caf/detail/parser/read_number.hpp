@@ -44,6 +44,10 @@ void read_negative_number(State& ps, Consumer& consumer, EnableFloat = {},
   auto result = int64_t{0};
   auto disabled = false;
   using odbl = std::optional<double>;
+  // Negates `result` without overflowing for the smallest 64-bit integer.
+  auto abs_result = [&result] {
+    return uint64_t{0} - static_cast<uint64_t>(result);
+  };
   // clang-format off
   start();
   // Initial state.
@@ -89,8 +93,7 @@ void read_negative_number(State& ps, Consumer& consumer, EnableFloat = {},
     transition(neg_dec, decimal_chars, sub_ascii<10>(result, ch),
                pec::integer_underflow)
     fsm_epsilon_static_if(enable_float,
-                          read_floating_point(ps, consumer,
-                                      odbl{static_cast<double>(result)}, true),
+                          read_floating_point(ps, consumer, abs_result(), true),
                           done, "eE", disabled = true)
     transition_static_if(enable_float || enable_range, neg_dot, '.')
   }
@@ -99,8 +102,7 @@ void read_negative_number(State& ps, Consumer& consumer, EnableFloat = {},
                              read_number_range(ps, consumer, result),
                              done, '.', disabled = true)
     fsm_epsilon_static_if(enable_float,
-                          read_floating_point(ps, consumer,
-                                      odbl{static_cast<double>(result)}, true),
+                          read_floating_point(ps, consumer, abs_result(), true),
                           done, any_char, disabled = true)
     epsilon(done)
   }
@@ -168,8 +170,7 @@ void read_positive_number(State& ps, Consumer& consumer, EnableFloat = {},
     transition(pos_dec, decimal_chars, add_ascii<10>(result, ch),
                pec::integer_overflow)
     fsm_epsilon_static_if(enable_float,
-                          read_floating_point(ps, consumer,
-                                      odbl{static_cast<double>(result)}),
+                          read_floating_point(ps, consumer, result),
                           done, "eE", disabled = true)
     transition_static_if(enable_float || enable_range, pos_dot, '.')
   }
@@ -179,8 +180,7 @@ void read_positive_number(State& ps, Consumer& consumer, EnableFloat = {},
                              read_number_range(ps, consumer, result),
                              done, '.', disabled = true)
     fsm_epsilon_static_if(enable_float,
-                          read_floating_point(ps, consumer,
-                                      odbl{static_cast<double>(result)}),
+                          read_floating_point(ps, consumer, result),
                           done, any_char, disabled = true)
     epsilon(done)
   }
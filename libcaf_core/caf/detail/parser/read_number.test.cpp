@@ -272,7 +272,7 @@ TEST("integer mantissa with negative exponent") {
   CHECK_NUMBER(1e-6);
   // invalid numbers
   check_eq(p("-9.9999e-e511"), res_t{pec::unexpected_character});
-  check_eq(p("-9.9999e-511"), res_t{pec::exponent_underflow});
+  check_eq(p("-9.9999e-520"), res_t{pec::exponent_underflow});
 }
 
 TEST("fractional mantissa with positive exponent") {
@@ -297,6 +297,22 @@ TEST("fractional mantissa with negative exponent") {
   CHECK_NUMBER(-42.0001e-5);
 }
 
+TEST("floating point numbers keep all digits of the integer part") {
+  // The integer part exceeds 2^53, so converting it to a double before
+  // reading the fractional part would round twice.
+  auto read = [](std::string_view str) {
+    number_consumer f;
+    string_parser_state ps{str.begin(), str.end()};
+    detail::parser::read_number(ps, f);
+    auto* val = std::get_if<double>(&f.x);
+    return ps.code == pec::success && val != nullptr ? *val : 0.0;
+  };
+  check(read("9007199254740993.5") == 9007199254740994.0);
+  check(read("-9007199254740993.5") == -9007199254740994.0);
+  check(read("9223372036854775807.0") == 9223372036854775807.0);
+  check(read("-9223372036854775808.0") == -9223372036854775808.0);
+}
+
 #define CHECK_RANGE(expr, ...)                                                 \
   check_eq(r(expr), std::vector<int64_t>({__VA_ARGS__}))
 
@@ -5,15 +5,18 @@
 #pragma once
 
 #include "caf/chrono.hpp"
+#include "caf/detail/assert.hpp"
 #include "caf/detail/core_export.hpp"
 #include "caf/none.hpp"
 
+#include <charconv>
 #include <chrono>
 #include <concepts>
 #include <cstdint>
 #include <ctime>
 #include <limits>
 #include <string_view>
+#include <system_error>
 #include <type_traits>
 
 namespace caf::detail {
@@ -217,18 +220,14 @@ void print(Buffer& buf, T x) {
 
 template <class Buffer, std::floating_point T>
 void print(Buffer& buf, T x) {
-  // TODO: Check whether to_chars is available on supported compilers and
-  //       re-implement using the new API as soon as possible.
-  auto str = std::to_string(x);
-  if (str.find('.') != std::string::npos) {
-    // Drop trailing zeros.
-    while (str.back() == '0')
-      str.pop_back();
-    // Drop trailing dot as well if we've removed all decimal places.
-    if (str.back() == '.')
-      str.pop_back();
-  }
-  buf.insert(buf.end(), str.begin(), str.end());
+  // Prints the shortest representation that parses back to the same value.
+  // The longest output is a negative long double in scientific notation with
+  // 21 significant digits and a five-digit exponent.
+  char stack_buffer[48];
+  auto res = std::to_chars(stack_buffer, stack_buffer + sizeof(stack_buffer),
+                           x);
+  CAF_ASSERT(res.ec == std::errc{});
+  buf.insert(buf.end(), stack_buffer, res.ptr);
 }
 
 template <class Buffer, class Rep, class Period>
@@ -247,11 +246,14 @@ void print(Buffer& buf, std::chrono::duration<Rep, Period> x) {
     return true;
   };
   namespace sc = std::chrono;
-  using hours = sc::duration<double, std::ratio<3600>>;
-  using minutes = sc::duration<double, std::ratio<60>>;
-  using seconds = sc::duration<double>;
-  using milliseconds = sc::duration<double, std::milli>;
-  using microseconds = sc::duration<double, std::micro>;
+  // Keep the precision of floating point durations to avoid printing
+  // conversion artifacts, e.g., 3.14f as 3.140000104904175.
+  using rep = std::conditional_t<std::is_floating_point_v<Rep>, Rep, double>;
+  using hours = sc::duration<rep, std::ratio<3600>>;
+  using minutes = sc::duration<rep, std::ratio<60>>;
+  using seconds = sc::duration<rep>;
+  using milliseconds = sc::duration<rep, std::milli>;
+  using microseconds = sc::duration<rep, std::micro>;
   if (try_print(sc::duration_cast<hours>(x), "h")
       || try_print(sc::duration_cast<minutes>(x), "min")
       || try_print(sc::duration_cast<seconds>(x), "s")
@@ -162,8 +162,7 @@ public:
 
   bool value(float x) {
     sep();
-    auto str = std::to_string(x);
-    result_ += str;
+    detail::print(result_, x);
     return true;
   }
 
@@ -129,8 +129,11 @@ TEST("stringification of numbers") {
   check_eq(do_render(-3.14), "-3.14"s);
   check_eq(do_render(3.141592f), "3.141592"s);
   check_eq(do_render(-3.141592f), "-3.141592"s);
-  check_eq(do_render(3.14159265358979323846L), "3.141593"s);
-  check_eq(do_render(-3.14159265358979323846L), "-3.141593"s);
+  check_eq(do_render(3.5L), "3.5"s);
+  check_eq(do_render(-0.125L), "-0.125"s);
+  // The number of digits depends on the precision of long double.
+  check(do_render(3.14159265358979323846L).starts_with("3.141592653589793"));
+  check(do_render(-3.14159265358979323846L).starts_with("-3.141592653589793"));
 }
 
 TEST("stringification of booleans") {
@@ -0,0 +1,28 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/thread_shard.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <thread>
+
+namespace caf::detail {
+
+size_t this_thread_shard() noexcept {
+  static std::atomic<size_t> next_shard = 0;
+  thread_local auto shard = next_shard.fetch_add(1, std::memory_order_relaxed);
+  return shard;
+}
+
+size_t default_thread_shards() noexcept {
+  static const auto result = [] {
+    size_t n = std::thread::hardware_concurrency();
+    return std::bit_ceil(std::clamp(n, size_t{1}, max_thread_shards));
+  }();
+  return result;
+}
+
+} // namespace caf::detail
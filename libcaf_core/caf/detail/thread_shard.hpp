@@ -0,0 +1,26 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/detail/core_export.hpp"
+
+#include <cstddef>
+
+namespace caf::detail {
+
+/// Maximum number of shards for striped data structures.
+constexpr size_t max_thread_shards = 64;
+
+/// Returns a stable number for the calling thread. Threads receive consecutive
+/// numbers in the order in which they call this function for the first time.
+/// Striped data structures map this number to one of their shards.
+CAF_CORE_EXPORT size_t this_thread_shard() noexcept;
+
+/// Returns the number of shards that striped data structures should use by
+/// default, i.e., the hardware concurrency rounded up to the next power of two
+/// but at most `max_thread_shards`.
+CAF_CORE_EXPORT size_t default_thread_shards() noexcept;
+
+} // namespace caf::detail
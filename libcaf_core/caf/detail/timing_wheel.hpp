@@ -0,0 +1,220 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace caf::detail {
+
+/// A hierarchical timing wheel that stores values with a deadline, measured in
+/// ticks. Inserting a value is O(1). The wheel has `num_levels` levels with
+/// `slots_per_level` slots each. Values with a deadline within the next
+/// `slots_per_level` ticks go to the lowest level. All other values go to a
+/// coarser level and move down lazily ("cascading") when the wheel reaches the
+/// start of their slot. Values with a deadline beyond the range of the highest
+/// level go to its farthest slot and cascade until they reach their deadline.
+/// @note The wheel is not thread-safe.
+template <class T>
+class timing_wheel {
+public:
+  // -- member types -----------------------------------------------------------
+
+  using value_type = T;
+
+  // -- constants --------------------------------------------------------------
+
+  /// Number of bits for the slot index on each level.
+  static constexpr size_t bits_per_level = 6;
+
+  /// Number of slots on each level.
+  static constexpr size_t slots_per_level = size_t{1} << bits_per_level;
+
+  /// Number of levels in the wheel.
+  static constexpr size_t num_levels = 4;
+
+  /// Maximum distance between the current tick and a deadline that the wheel
+  /// can represent without cascading a value more than once per level.
+  static constexpr uint64_t max_distance
+    = (uint64_t{1} << (bits_per_level * num_levels)) - 1;
+
+  /// Marks the absence of a deadline.
+  static constexpr uint64_t no_deadline = std::numeric_limits<uint64_t>::max();
+
+  // -- constructors, destructors, and assignment operators --------------------
+
+  explicit timing_wheel(uint64_t start = 0) noexcept : current_(start) {
+    // nop
+  }
+
+  timing_wheel(const timing_wheel&) = delete;
+
+  timing_wheel& operator=(const timing_wheel&) = delete;
+
+  // -- properties -------------------------------------------------------------
+
+  /// Returns the next tick that the wheel is going to process.
+  uint64_t current_tick() const noexcept {
+    return current_;
+  }
+
+  /// Returns the number of stored values.
+  size_t size() const noexcept {
+    return size_;
+  }
+
+  /// Returns whether the wheel contains no values.
+  bool empty() const noexcept {
+    return size_ == 0;
+  }
+
+  /// Returns the next tick at which `advance` has work to do or `no_deadline`
+  /// if the wheel is empty. The result is either the deadline of a value on
+  /// the lowest level or the next tick that cascades a non-empty slot from a
+  /// higher level, whichever comes first.
+  uint64_t next_tick() const noexcept {
+    if (size_ == 0)
+      return no_deadline;
+    auto result = no_deadline;
+    for (size_t level = 0; level < num_levels; ++level) {
+      // Slots on level N cascade at the first tick of their range, i.e., at a
+      // multiple of the range of a slot on that level. Level 0 "cascades" at
+      // the deadline of its values.
+      auto shift = bits_per_level * level;
+      auto first = ((current_ + (uint64_t{1} << shift) - 1) >> shift) << shift;
+      for (size_t i = 0; i < slots_per_level; ++i) {
+        auto tick = first + (uint64_t{i} << shift);
+        if (tick >= result)
+          break;
+        if (!slots_[level][index_of(tick, level)].empty()) {
+          result = tick;
+          break;
+        }
+      }
+    }
+    return result;
+  }
+
+  // -- modifiers --------------------------------------------------------------
+
+  /// Adds `value` with the deadline `tick`. If `tick` already passed, the
+  /// value expires on the next call to `advance`.
+  void insert(uint64_t tick, value_type value) {
+    if (tick < current_)
+      tick = current_;
+    place(tick, entry{tick, std::move(value)});
+    ++size_;
+  }
+
+  /// Processes all ticks up to and including `tick` and calls `fn` with each
+  /// value that expires.
+  template <class F>
+  void advance(uint64_t tick, F&& fn) {
+    if (size_ == 0) {
+      if (tick >= current_)
+        current_ = tick + 1;
+      return;
+    }
+    while (current_ <= tick) {
+      cascade();
+      auto& slot = slots_[0][current_ & (slots_per_level - 1)];
+      // Swap out the slot to allow `fn` to insert new values. Values that `fn`
+      // inserts for the current tick end up in the same slot again.
+      while (!slot.empty()) {
+        slot_type expired;
+        expired.swap(slot);
+        size_ -= expired.size();
+        for (auto& x : expired)
+          fn(x.value);
+        // Keep the capacity of the slot to avoid allocations.
+        if (slot.empty()) {
+          expired.clear();
+          slot.swap(expired);
+        }
+      }
+      ++current_;
+      if (size_ == 0) {
+        current_ = tick + 1;
+        return;
+      }
+    }
+  }
+
+  /// Removes all values for which `pred` returns `true`.
+  /// @returns the number of removed values.
+  template <class Predicate>
+  size_t erase_if(Predicate pred) {
+    size_t result = 0;
+    for (auto& level : slots_)
+      for (auto& slot : level)
+        result += std::erase_if(slot, [&pred](entry& x) {
+          return pred(x.value);
+        });
+    size_ -= result;
+    return result;
+  }
+
+private:
+  struct entry {
+    uint64_t deadline;
+    value_type value;
+  };
+
+  using slot_type = std::vector<entry>;
+
+  using level_type = std::array<slot_type, slots_per_level>;
+
+  static size_t index_of(uint64_t tick, size_t level) noexcept {
+    return (tick >> (bits_per_level * level)) & (slots_per_level - 1);
+  }
+
+  /// Stores `x` in the slot for `tick` on the finest level that covers the
+  /// distance between the current tick and `tick`.
+  void place(uint64_t tick, entry&& x) {
+    auto distance = tick - current_;
+    for (size_t level = 0; level < num_levels - 1; ++level) {
+      if (distance < (uint64_t{1} << (bits_per_level * (level + 1)))) {
+        slots_[level][index_of(tick, level)].emplace_back(std::move(x));
+        return;
+      }
+    }
+    if (distance > max_distance)
+      tick = current_ + max_distance;
+    slots_[num_levels - 1][index_of(tick, num_levels - 1)].emplace_back(
+      std::move(x));
+  }
+
+  /// Moves values from higher levels down when reaching the start of their
+  /// slot.
+  void cascade() {
+    for (size_t level = 1; level < num_levels; ++level) {
+      // Level N only cascades when all lower levels wrapped around.
+      if (index_of(current_, level - 1) != 0)
+        return;
+      auto& slot = slots_[level][index_of(current_, level)];
+      if (!slot.empty()) {
+        slot_type moved;
+        moved.swap(slot);
+        for (auto& x : moved)
+          place(x.deadline, std::move(x));
+      }
+    }
+  }
+
+  /// Stores the values, indexed by level and slot.
+  std::array<level_type, num_levels> slots_;
+
+  /// The next tick to process.
+  uint64_t current_;
+
+  /// Number of stored values.
+  size_t size_ = 0;
+};
+
+} // namespace caf::detail
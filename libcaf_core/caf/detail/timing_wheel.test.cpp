@@ -0,0 +1,140 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/detail/timing_wheel.hpp"
+
+#include "caf/test/test.hpp"
+
+#include <vector>
+
+using namespace caf;
+
+namespace {
+
+using wheel_type = detail::timing_wheel<int>;
+
+/// Advances the wheel to `tick` and returns all expired values.
+std::vector<int> advance(wheel_type& uut, uint64_t tick) {
+  std::vector<int> result;
+  uut.advance(tick, [&result](int x) { result.push_back(x); });
+  return result;
+}
+
+} // namespace
+
+TEST("a default-constructed wheel is empty") {
+  wheel_type uut;
+  check(uut.empty());
+  check_eq(uut.size(), 0u);
+  check_eq(uut.current_tick(), 0u);
+  check_eq(uut.next_tick(), wheel_type::no_deadline);
+}
+
+TEST("values expire when the wheel reaches their deadline") {
+  wheel_type uut;
+  uut.insert(3, 3);
+  uut.insert(1, 1);
+  uut.insert(2, 2);
+  uut.insert(1, 11);
+  check_eq(uut.size(), 4u);
+  check_eq(uut.next_tick(), 1u);
+  check_eq(advance(uut, 0), std::vector<int>{});
+  check_eq(uut.next_tick(), 1u);
+  check_eq(advance(uut, 1), std::vector<int>({1, 11}));
+  check_eq(advance(uut, 3), std::vector<int>({2, 3}));
+  check(uut.empty());
+  check_eq(uut.current_tick(), 4u);
+}
+
+TEST("values with a past deadline expire on the next advance") {
+  wheel_type uut;
+  check_eq(advance(uut, 9), std::vector<int>{});
+  check_eq(uut.current_tick(), 10u);
+  uut.insert(5, 5);
+  check_eq(uut.next_tick(), 10u);
+  check_eq(advance(uut, 10), std::vector<int>{5});
+}
+
+TEST("values on higher levels cascade down before they expire") {
+  wheel_type uut;
+  uut.insert(100, 100);
+  uut.insert(5'000, 5'000);
+  uut.insert(300'000, 300'000);
+  check_eq(advance(uut, 99), std::vector<int>{});
+  check_eq(advance(uut, 100), std::vector<int>{100});
+  check_eq(advance(uut, 4'999), std::vector<int>{});
+  check_eq(advance(uut, 5'000), std::vector<int>{5'000});
+  check_eq(advance(uut, 299'999), std::vector<int>{});
+  check_eq(advance(uut, 300'000), std::vector<int>{300'000});
+  check(uut.empty());
+}
+
+TEST("values beyond the range of the wheel expire at their deadline") {
+  wheel_type uut;
+  auto deadline = wheel_type::max_distance * 3;
+  uut.insert(deadline, 1);
+  check_eq(advance(uut, deadline - 1), std::vector<int>{});
+  check_eq(uut.size(), 1u);
+  check_eq(advance(uut, deadline), std::vector<int>{1});
+}
+
+TEST("next_tick never skips a deadline") {
+  wheel_type uut;
+  for (auto tick : {7u, 70u, 700u, 7'000u})
+    uut.insert(tick, static_cast<int>(tick));
+  std::vector<int> expired;
+  while (!uut.empty()) {
+    auto next = uut.next_tick();
+    require_ne(next, wheel_type::no_deadline);
+    // Advancing to the tick before the next tick must not expire anything.
+    if (next > uut.current_tick())
+      check_eq(advance(uut, next - 1), std::vector<int>{});
+    for (auto x : advance(uut, next))
+      expired.push_back(x);
+  }
+  check_eq(expired, std::vector<int>({7, 70, 700, 7'000}));
+}
+
+TEST("next_tick only returns ticks that cascade non-empty slots") {
+  wheel_type uut;
+  // 30'000 lives in slot 7 on level 2, which cascades at 7 * 4'096 = 28'672.
+  // From there, it moves to level 1 and cascades again at 468 * 64 = 29'952.
+  uut.insert(30'000, 1);
+  check_eq(uut.next_tick(), 28'672u);
+  check_eq(advance(uut, 28'672), std::vector<int>{});
+  check_eq(uut.next_tick(), 29'952u);
+  check_eq(advance(uut, 29'952), std::vector<int>{});
+  check_eq(uut.next_tick(), 30'000u);
+  check_eq(advance(uut, 30'000), std::vector<int>{1});
+  check_eq(uut.next_tick(), wheel_type::no_deadline);
+}
+
+TEST("callbacks may insert values for the current tick") {
+  wheel_type uut;
+  uut.insert(1, 1);
+  std::vector<int> expired;
+  uut.advance(1, [&](int x) {
+    expired.push_back(x);
+    if (x == 1)
+      uut.insert(uut.current_tick(), 2);
+  });
+  check_eq(expired, std::vector<int>({1, 2}));
+  check(uut.empty());
+}
+
+TEST("erase_if removes values from all levels") {
+  wheel_type uut;
+  for (auto tick = 1; tick < 10'000; tick += 3)
+    uut.insert(static_cast<uint64_t>(tick), tick);
+  auto total = uut.size();
+  auto erased = uut.erase_if([](int x) { return x % 2 == 0; });
+  check_eq(uut.size(), total - erased);
+  auto values = advance(uut, 10'000);
+  check_eq(values.size(), total - erased);
+  auto all_odd = true;
+  for (auto x : values)
+    if (x % 2 == 0)
+      all_odd = false;
+  check(all_odd);
+}
@@ -6,6 +6,7 @@
 
 #include "caf/config.hpp"
 #include "caf/detail/assert.hpp"
+#include "caf/detail/offset_table.hpp"
 #include "caf/hash/fnv.hpp"
 #include "caf/raise_error.hpp"
 #include "caf/type_id_list.hpp"
@@ -71,8 +72,14 @@ std::unordered_set<dyn_type_id_list> type_id_list_cache;
 const type_id_t* get_or_set_type_id_buf(type_id_t* ptr) {
   dyn_type_id_list dl{ptr};
   std::unique_lock<std::mutex> guard{type_id_list_cache_mx};
-  auto iter = type_id_list_cache.emplace(std::move(dl)).first;
-  return iter->storage;
+  auto [iter, added] = type_id_list_cache.emplace(std::move(dl));
+  auto result = iter->storage;
+  guard.unlock();
+  // Compute the offsets when interning a new list to keep message_data::at
+  // from computing them on the critical path later.
+  if (added)
+    precompute_offset_table(type_id_list{result});
+  return result;
 }
 
 } // namespace
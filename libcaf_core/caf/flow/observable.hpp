@@ -1109,8 +1109,9 @@ observable<T> observable<T>::share(size_t subscriber_threshold) {
 template <class T>
 observable<T> observable<T>::observe_on(coordinator* other, size_t buffer_size,
                                         size_t min_request_size) {
-  auto [pull, push] = async::make_spsc_buffer_resource<T>(buffer_size,
-                                                          min_request_size);
+  // The buffer only has a single producer: this observable.
+  auto [pull, push] = async::make_spsc_buffer_resource<T>(
+    buffer_size, min_request_size, async::spsc_buffer_mode::lock_free);
   subscribe(push);
   return other->add_child_hdl(std::in_place_type<op::from_resource<T>>,
                               std::move(pull));
@@ -1122,7 +1123,8 @@ template <class T>
 async::consumer_resource<T>
 observable<T>::to_resource(size_t buffer_size, size_t min_request_size) {
   using buffer_type = async::spsc_buffer<T>;
-  auto buf = make_counted<buffer_type>(buffer_size, min_request_size);
+  auto buf = make_counted<buffer_type>(buffer_size, min_request_size,
+                                       async::spsc_buffer_mode::lock_free);
   auto up = make_counted<buffer_writer_impl<buffer_type>>(pimpl_->parent());
   up->init(buf);
   subscribe(up->as_observer());
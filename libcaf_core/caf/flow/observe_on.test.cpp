@@ -11,6 +11,7 @@
 #include "caf/flow/observable_builder.hpp"
 
 #include <memory>
+#include <numeric>
 
 using namespace caf;
 
@@ -38,4 +39,26 @@ SCENARIO("observe_on moves data between actors") {
   }
 }
 
+SCENARIO("observe_on moves more items than its buffer can hold") {
+  GIVEN("a generation with more items than the buffer size") {
+    WHEN("calling observe_on with a small buffer") {
+      THEN("the target actor observes all values in order") {
+        auto inputs = std::vector<int>(1'000);
+        std::iota(inputs.begin(), inputs.end(), 0);
+        auto outputs = std::vector<int>{};
+        auto [src, launch_src] = sys.spawn_inactive();
+        auto [snk, launch_snk] = sys.spawn_inactive();
+        src->make_observable()
+          .from_container(inputs)
+          .observe_on(snk, 8, 2)
+          .for_each([&outputs](int x) { outputs.emplace_back(x); });
+        launch_src();
+        launch_snk();
+        dispatch_messages();
+        check_eq(inputs, outputs);
+      }
+    }
+  }
+}
+
 } // WITH_FIXTURE(test::fixture::deterministic)
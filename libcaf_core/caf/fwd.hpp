@@ -109,6 +109,7 @@ class attachable;
 class behavior;
 class binary_deserializer;
 class binary_serializer;
+class binary_size_calculator;
 class blocking_actor;
 class chunk;
 class chunked_string;
@@ -282,12 +283,20 @@ class metric_family_impl;
 template <class Type>
 class metric_impl;
 
+template <class ValueType>
+class sharded_counter;
+
+template <class ValueType>
+class sharded_gauge;
+
 using dbl_counter = counter<double>;
 using dbl_gauge = gauge<double>;
 using dbl_histogram = histogram<double>;
 using int_counter = counter<int64_t>;
 using int_gauge = gauge<int64_t>;
 using int_histogram = histogram<int64_t>;
+using sharded_int_counter = sharded_counter<int64_t>;
+using sharded_int_gauge = sharded_gauge<int64_t>;
 
 using dbl_counter_family = metric_family_impl<dbl_counter>;
 using dbl_histogram_family = metric_family_impl<dbl_histogram>;
@@ -295,6 +304,8 @@ using dbl_gauge_family = metric_family_impl<dbl_gauge>;
 using int_counter_family = metric_family_impl<int_counter>;
 using int_histogram_family = metric_family_impl<int_histogram>;
 using int_gauge_family = metric_family_impl<int_gauge>;
+using sharded_int_counter_family = metric_family_impl<sharded_int_counter>;
+using sharded_int_gauge_family = metric_family_impl<sharded_int_gauge>;
 
 } // namespace telemetry
 
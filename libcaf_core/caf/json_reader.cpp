@@ -15,6 +15,7 @@
 
 #include <fstream>
 #include <memory_resource>
+#include <unordered_map>
 
 namespace {
 
@@ -120,6 +121,23 @@ public:
     }
   };
 
+  /// Points into a JSON object for looking up its fields. Deserializers
+  /// usually read fields in the same order as serializers write them, so
+  /// lookups start at the member after the previous match.
+  struct object_cursor {
+    const detail::json::object* obj;
+
+    detail::json::object::const_iterator next;
+
+    /// Signals whether all members before `next` matched in order. Otherwise,
+    /// a member that we skipped may have the same key as `next`.
+    bool in_order = true;
+
+    /// Signals whether the object has no duplicate keys. Only set after
+    /// building the hash index.
+    bool unique_keys = false;
+  };
+
   struct members {
     detail::json::object::const_iterator pos;
 
@@ -141,13 +159,23 @@ public:
   using json_key = std::string_view;
 
   using value_type
-    = std::variant<const detail::json::value*, const detail::json::object*,
+    = std::variant<const detail::json::value*, object_cursor,
                    detail::json::null_t, json_key, sequence, members>;
 
   using stack_allocator = std::pmr::polymorphic_allocator<value_type>;
 
   using stack_type = std::vector<value_type, stack_allocator>;
 
+  using member_node = detail::json::linked_list_node<detail::json::member>;
+
+  /// Maps keys to their first occurrence in an object.
+  using member_index = std::pmr::unordered_map<std::string_view,
+                                               const member_node*>;
+
+  /// Stores the index for each object that we have built an index for.
+  using member_index_map
+    = std::pmr::unordered_map<const detail::json::object*, member_index>;
+
   /// Denotes the type at the current position.
   enum class position {
     value,
@@ -175,6 +203,10 @@ public:
   /// The value value for `field_type_suffix()`.
   static constexpr std::string_view field_type_suffix_default = "-type";
 
+  /// Objects with more members than this get a hash index for looking up
+  /// fields that are out of order.
+  static constexpr size_t max_linear_lookup_size = 16;
+
   // -- constructors, destructors, and assignment operators --------------------
 
   impl(actor_system* sys, deserializer* parent) : sys_(sys), parent_(parent) {
@@ -309,6 +341,7 @@ public:
   void reset() {
     buf_.release();
     st_ = nullptr;
+    indexes_ = nullptr;
     err_.reset();
     field_.clear();
   }
@@ -376,7 +409,8 @@ public:
     FN_DECL;
     return consume<false>(fn, [this](const detail::json::value& val) {
       if (val.data.index() == detail::json::value::object_index) {
-        push(&std::get<detail::json::object>(val.data));
+        auto& obj = std::get<detail::json::object>(val.data);
+        push(object_cursor{&obj, obj.begin()});
         return true;
       } else {
         err_ = format_to_error(
@@ -414,7 +448,7 @@ public:
   bool begin_field(std::string_view name) override {
     SCOPE(position::object);
     field_.push_back(name);
-    if (auto member = find_member(top<position::object>(), name)) {
+    if (auto member = find_field(name)) {
       push(member->val);
       return true;
     } else {
@@ -428,7 +462,7 @@ public:
   bool begin_field(std::string_view name, bool& is_present) override {
     SCOPE(position::object);
     field_.push_back(name);
-    if (auto member = find_member(top<position::object>(), name);
+    if (auto member = find_field(name);
         member != nullptr
         && member->val->data.index() != detail::json::value::null_index) {
       push(member->val);
@@ -461,10 +495,11 @@ public:
                    std::span<const type_id_t> types, size_t& index) override {
     SCOPE(position::object);
     field_.push_back(name);
-    if (auto member = find_member(top<position::object>(), name);
+    if (auto member = find_field(name);
         member != nullptr
         && member->val->data.index() != detail::json::value::null_index) {
-      auto ft = field_type(top<position::object>(), name, field_type_suffix_);
+      auto ft = field_type(top<position::object>().obj, name,
+                           field_type_suffix_);
       if (auto id = (*mapper_)(ft); id != invalid_type_id) {
         if (auto i = std::ranges::find(types, id); i != types.end()) {
           index = static_cast<size_t>(std::distance(types.begin(), i));
@@ -858,6 +893,53 @@ private:
     st_->pop_back();
   }
 
+  /// Looks up the field `name` in the object at the top of the stack.
+  const detail::json::member* find_field(std::string_view name) {
+    auto& cursor = top<position::object>();
+    auto* obj = cursor.obj;
+    // Fast path: the field follows the previous one. After skipping members,
+    // this only holds if the key has no earlier occurrence.
+    if (cursor.next != obj->end() && cursor.next->key == name
+        && (cursor.in_order || cursor.unique_keys))
+      return std::addressof(*cursor.next++);
+    const member_node* node = nullptr;
+    if (obj->size() <= max_linear_lookup_size) {
+      for (auto i = obj->begin(); i != obj->end(); ++i) {
+        if (i->key == name) {
+          node = i.get();
+          break;
+        }
+      }
+    } else {
+      auto& index = member_index_of(obj);
+      // The index only stores the first occurrence of each key.
+      cursor.unique_keys = index.size() == obj->size();
+      if (auto i = index.find(name); i != index.end())
+        node = i->second;
+    }
+    if (node == nullptr)
+      return nullptr;
+    cursor.in_order = false;
+    cursor.next = detail::json::object::const_iterator{node->next};
+    return std::addressof(node->value);
+  }
+
+  /// Returns the hash index for `obj`, building it on first access.
+  member_index& member_index_of(const detail::json::object* obj) {
+    if (indexes_ == nullptr) {
+      std::pmr::polymorphic_allocator<member_index_map> alloc{&buf_};
+      indexes_ = new (alloc.allocate(1)) member_index_map(alloc);
+    }
+    auto [i, added] = indexes_->try_emplace(obj);
+    auto& index = i->second;
+    if (added) {
+      index.reserve(obj->size());
+      for (auto node = obj->begin().get(); node != nullptr; node = node->next)
+        index.try_emplace(node->value.key, node);
+    }
+    return index;
+  }
+
   template <class T>
   void push(T&& x) {
     st_->emplace_back(std::forward<T>(x));
@@ -888,6 +970,9 @@ private:
 
   stack_type* st_ = nullptr;
 
+  /// Lazily created hash indexes for large objects. Lives in `buf_`.
+  member_index_map* indexes_ = nullptr;
+
   detail::json::value* root_ = nullptr;
 
   std::string_view field_type_suffix_ = field_type_suffix_default;
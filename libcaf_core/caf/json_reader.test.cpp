@@ -13,6 +13,11 @@
 #include "caf/init_global_meta_objects.hpp"
 #include "caf/log/test.hpp"
 
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
 using namespace caf;
 
 using namespace std::literals;
@@ -460,6 +465,35 @@ fixture::fixture() {
   add_neg_test_case<std::string>(R"_("\u06c")_");
 }
 
+// Generates a JSON object with `n` fields. Field `fN` has the value `N`.
+std::string make_object(size_t n) {
+  std::string result = "{";
+  for (size_t i = 0; i < n; ++i) {
+    if (i > 0)
+      result += ", ";
+    result += R"(")";
+    result += "f" + std::to_string(i);
+    result += R"(": )";
+    result += std::to_string(i);
+  }
+  result += '}';
+  return result;
+}
+
+// Reads the fields with the given indexes and checks their values.
+bool read_fields(json_reader& reader, const std::vector<size_t>& indexes) {
+  if (!reader.begin_object(invalid_type_id, "object"))
+    return false;
+  for (auto index : indexes) {
+    auto name = "f" + std::to_string(index);
+    auto val = size_t{0};
+    if (!reader.begin_field(name) || !reader.value(val) || !reader.end_field()
+        || val != index)
+      return false;
+  }
+  return reader.end_object();
+}
+
 } // namespace
 
 WITH_FIXTURE(fixture) {
@@ -528,4 +562,47 @@ SCENARIO("mappers enable custom type names in JSON input") {
   }
 }
 
+TEST("the reader finds fields in any order") {
+  for (size_t n : {8u, 200u}) {
+    auto input = make_object(n);
+    std::vector<size_t> indexes(n);
+    std::iota(indexes.begin(), indexes.end(), size_t{0});
+    json_reader reader;
+    require(reader.load(input));
+    check(read_fields(reader, indexes));
+    // Reverse order.
+    std::reverse(indexes.begin(), indexes.end());
+    reader.revert();
+    check(read_fields(reader, indexes));
+    reader.revert();
+    check(read_fields(reader, indexes));
+    // Skipping fields.
+    std::vector<size_t> odd;
+    for (auto i = size_t{1}; i < n; i += 2)
+      odd.push_back(i);
+    reader.revert();
+    check(read_fields(reader, odd));
+    // Missing fields.
+    reader.revert();
+    check(!read_fields(reader, {n}));
+  }
+}
+
+TEST("the reader uses the first occurrence of duplicate keys") {
+  auto input = make_object(100);
+  input.back() = ',';
+  input += R"( "f0": 1})";
+  json_reader reader;
+  require(reader.load(input));
+  check(read_fields(reader, {50, 0}));
+  reader.revert();
+  check(read_fields(reader, {99, 0}));
+  // Same for objects that are too small for a hash index.
+  input = make_object(3);
+  input.back() = ',';
+  input += R"( "f0": 1})";
+  require(reader.load(input));
+  check(read_fields(reader, {2, 0}));
+}
+
 } // WITH_FIXTURE(fixture)
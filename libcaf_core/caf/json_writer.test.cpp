@@ -221,6 +221,19 @@ SCENARIO("the JSON writer converts builtin types to strings") {
       }
     }
   }
+  GIVEN("a floating point number") {
+    WHEN("converting it to JSON") {
+      THEN("the JSON output is the shortest round-trip representation") {
+        check_eq(to_json_string(1.0, 0), "1"s);
+        check_eq(to_json_string(-0.5, 0), "-0.5"s);
+        check_eq(to_json_string(0.1, 0), "0.1"s);
+        check_eq(to_json_string(1.0 / 3.0, 0), "0.3333333333333333"s);
+        check_eq(to_json_string(1e-7, 0), "1e-07"s);
+        check_eq(to_json_string(1.5e300, 0), "1.5e+300"s);
+        check_eq(to_json_string(0.1f, 0), "0.1"s);
+      }
+    }
+  }
   GIVEN("a string") {
     std::string x = R"_(hello "world"!)_";
     WHEN("converting it to JSON with any indentation factor") {
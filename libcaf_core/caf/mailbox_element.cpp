@@ -4,7 +4,11 @@
 
 #include "caf/mailbox_element.hpp"
 
+#include "caf/detail/message_pool.hpp"
+#include "caf/raise_error.hpp"
+
 #include <memory>
+#include <new>
 
 namespace caf {
 
@@ -14,6 +18,20 @@ mailbox_element::mailbox_element(strong_actor_ptr sender, message_id mid,
   // nop
 }
 
+#ifdef CAF_ENABLE_MESSAGE_POOL
+
+void* mailbox_element::operator new(size_t size) {
+  if (auto* ptr = detail::message_pool::allocate(size))
+    return ptr;
+  CAF_RAISE_ERROR(std::bad_alloc, "bad_alloc");
+}
+
+void mailbox_element::operator delete(void* ptr) noexcept {
+  detail::message_pool::deallocate(ptr);
+}
+
+#endif
+
 mailbox_element_ptr make_mailbox_element(strong_actor_ptr sender, message_id id,
                                          message payload) {
   return std::make_unique<mailbox_element>(std::move(sender), id,
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "caf/actor_control_block.hpp"
+#include "caf/config.hpp"
 #include "caf/detail/core_export.hpp"
 #include "caf/intrusive/singly_linked.hpp"
 #include "caf/message.hpp"
@@ -57,6 +58,16 @@ public:
     return mid.category() == message_id::urgent_message_category;
   }
 
+#ifdef CAF_ENABLE_MESSAGE_POOL
+  // -- memory management ------------------------------------------------------
+
+  /// Allocates mailbox elements from the message pool.
+  static void* operator new(size_t size);
+
+  /// Returns mailbox elements to the message pool.
+  static void operator delete(void* ptr) noexcept;
+#endif
+
   mailbox_element(mailbox_element&&) = delete;
   mailbox_element(const mailbox_element&) = delete;
   mailbox_element& operator=(mailbox_element&&) = delete;
@@ -7,6 +7,7 @@
 #include "caf/actor_system.hpp"
 #include "caf/binary_deserializer.hpp"
 #include "caf/binary_serializer.hpp"
+#include "caf/binary_size_calculator.hpp"
 #include "caf/deserializer.hpp"
 #include "caf/detail/assert.hpp"
 #include "caf/detail/meta_object.hpp"
@@ -75,7 +76,8 @@ bool load_data(Deserializer& source, message::data_ptr& data) {
     GUARDED(source.end_sequence());
     CAF_ASSERT(ids.size() == msg_size);
     intrusive_ptr<detail::message_data> ptr;
-    if (auto vptr = malloc(sizeof(detail::message_data) + data_size)) {
+    if (auto vptr = detail::message_data::allocate(sizeof(detail::message_data)
+                                                    + data_size)) {
       // We don't need to worry about exceptions here: the message_data
       // constructor as well as `move_to_list` are `noexcept`.
       ptr.reset(new (vptr) detail::message_data(ids.move_to_list()), adopt_ref);
@@ -171,7 +173,8 @@ bool load_data(Deserializer& source, message::data_ptr& data) {
     GUARDED(source.end_sequence());
     // Merge elements into a single message data object.
     intrusive_ptr<detail::message_data> ptr;
-    if (auto vptr = malloc(sizeof(detail::message_data) + data_size)) {
+    if (auto vptr = detail::message_data::allocate(sizeof(detail::message_data)
+                                                    + data_size)) {
       // We don't need to worry about exceptions here: the message_data
       // constructor as well as `move_to_list` are `noexcept`.
       ptr.reset(new (vptr) detail::message_data(ids.move_to_list()), adopt_ref);
@@ -215,6 +218,11 @@ bool save(const detail::meta_object& meta, caf::binary_serializer& sink,
   return meta.save_binary(sink, obj);
 }
 
+bool save(const detail::meta_object& meta, caf::binary_size_calculator& sink,
+          const void* obj) {
+  return meta.binary_size(sink, obj);
+}
+
 template <class Serializer>
 bool save_data(Serializer& sink, const message::data_ptr& data) {
   auto gmos = detail::global_meta_objects();
@@ -277,6 +285,10 @@ bool message::save(binary_serializer& sink) const {
   return save_data(sink, data_);
 }
 
+bool message::save(binary_size_calculator& sink) const {
+  return save_data(sink, data_);
+}
+
 bool message::save(detail::stringification_inspector& sink) const {
   auto str = to_string(*this);
   return sink.value(str);
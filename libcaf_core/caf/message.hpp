@@ -9,6 +9,7 @@
 #include "caf/detail/core_export.hpp"
 #include "caf/detail/implicit_conversions.hpp"
 #include "caf/detail/message_data.hpp"
+#include "caf/detail/offset_at.hpp"
 #include "caf/detail/padded_size.hpp"
 #include "caf/fwd.hpp"
 #include "caf/intrusive_cow_ptr.hpp"
@@ -137,6 +138,8 @@ public:
 
   bool save(binary_serializer& sink) const;
 
+  bool save(binary_size_calculator& sink) const;
+
   bool save(detail::stringification_inspector& sink) const;
 
   bool load(deserializer& source);
@@ -242,10 +245,11 @@ message make_message(Ts&&... xs) {
   static constexpr size_t data_size
     = sizeof(message_data) + (padded_size_v<strip_and_convert_t<Ts>> + ...);
   auto types = make_type_id_list<strip_and_convert_t<Ts>...>();
-  auto vptr = malloc(data_size);
+  auto vptr = message_data::allocate(data_size);
   if (vptr == nullptr)
     CAF_RAISE_ERROR(std::bad_alloc, "bad_alloc");
-  auto raw_ptr = new (vptr) message_data(types);
+  auto& offsets = offset_table_v<strip_and_convert_t<Ts>...>;
+  auto raw_ptr = new (vptr) message_data(types, offsets.data());
   intrusive_cow_ptr<message_data> ptr{raw_ptr, adopt_ref};
   raw_ptr->init(std::forward<Ts>(xs)...);
   return message{std::move(ptr)};
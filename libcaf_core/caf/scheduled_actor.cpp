@@ -177,9 +177,9 @@ bool scheduled_actor::enqueue(mailbox_element_ptr ptr, scheduler* sched) {
   CAF_LOG_SEND_EVENT(ptr);
   auto mid = ptr->mid;
   auto sender = ptr->sender;
-  if (auto* mailbox_size = metrics_.mailbox_size) {
+  if (auto& mailbox_size = metrics_.mailbox_size) {
     ptr->set_enqueue_time();
-    mailbox_size->inc();
+    mailbox_size.inc();
   }
   switch (mailbox().push_back(std::move(ptr))) {
     case intrusive::inbox_result::unblocked_reader: {
@@ -201,8 +201,8 @@ bool scheduled_actor::enqueue(mailbox_element_ptr ptr, scheduler* sched) {
     default: { // intrusive::inbox_result::queue_closed
       CAF_LOG_REJECT_EVENT();
       home_system().message_rejected(this);
-      if (auto* mailbox_size = metrics_.mailbox_size) {
-        mailbox_size->dec();
+      if (auto& mailbox_size = metrics_.mailbox_size) {
+        mailbox_size.dec();
       }
       if (mid.is_request()) {
         detail::sync_request_bouncer f;
@@ -275,8 +275,7 @@ void scheduled_actor::on_cleanup(const error& reason) {
   if (private_thread_)
     home_system().release_private_thread(private_thread_);
   // Clear state for open requests, flows and streams.
-  awaited_responses_.clear();
-  multiplexed_responses_.clear();
+  clear_response_handlers();
   cancel_flows_and_streams();
   close_mailbox(reason);
   // Dispatch to parent's `on_cleanup` function.
@@ -303,11 +302,13 @@ void scheduled_actor::resume(scheduler* sched, uint64_t event_id) {
   if (!activate(sched))
     return;
   size_t consumed = 0;
+  // Flushes when leaving the scope, i.e., after the guard below ran.
+  metrics_batch batch{metrics_};
   auto guard = detail::scope_guard{[this, &consumed]() noexcept {
     if (consumed > 0) {
       auto val = static_cast<int64_t>(consumed);
       if (metrics_.processed_messages)
-        metrics_.processed_messages->inc(val);
+        metrics_.processed_messages.inc(val);
     }
   }};
   auto reset_timeouts_if_needed = [&] {
@@ -326,7 +327,7 @@ void scheduled_actor::resume(scheduler* sched, uint64_t event_id) {
       }
       continue; // Interrupted by a new message, try again.
     }
-    auto res = run_with_metrics(*ptr, [this, &ptr, &consumed] {
+    auto res = run_with_metrics(*ptr, batch, [this, &ptr, &consumed] {
       auto res = reactivate(*ptr);
       switch (res) {
         case activation_result::success:
@@ -376,8 +377,7 @@ void scheduled_actor::quit(error x) {
   fail_state_ = std::move(x);
   // Clear state for handling regular messages.
   bhvr_stack_.clear();
-  awaited_responses_.clear();
-  multiplexed_responses_.clear();
+  clear_response_handlers();
   // Ignore future exit, down and error messages.
   exit_handler_ = silently_ignore<exit_msg>;
   down_handler_ = silently_ignore<down_msg>;
@@ -617,12 +617,29 @@ void scheduled_actor::add_awaited_response_handler(message_id response_id,
                                                    disposable pending_timeout) {
   awaited_responses_.emplace_front(response_id, std::move(bhvr),
                                    std::move(pending_timeout));
+  if (auto* pending_requests = metrics_.pending_requests)
+    pending_requests->inc();
 }
 
 void scheduled_actor::add_multiplexed_response_handler(
   message_id response_id, behavior bhvr, disposable pending_timeout) {
-  multiplexed_responses_.emplace(
+  auto added = multiplexed_responses_.emplace(
     response_id, std::pair{std::move(bhvr), std::move(pending_timeout)});
+  if (auto* pending_requests = metrics_.pending_requests; pending_requests
+                                                          && added)
+    pending_requests->inc();
+}
+
+void scheduled_actor::clear_response_handlers() {
+  if (auto* pending_requests = metrics_.pending_requests) {
+    auto awaited = std::distance(awaited_responses_.begin(),
+                                 awaited_responses_.end());
+    auto multiplexed = multiplexed_responses_.size();
+    pending_requests->dec(static_cast<int64_t>(awaited)
+                          + static_cast<int64_t>(multiplexed));
+  }
+  awaited_responses_.clear();
+  multiplexed_responses_.clear();
 }
 
 scheduled_actor::message_category
@@ -815,6 +832,8 @@ invoke_message_result scheduled_actor::consume(mailbox_element& x) {
       auto f = std::move(std::get<1>(pr));
       std::get<2>(pr).dispose(); // Stop the timeout.
       awaited_responses_.pop_front();
+      if (auto* pending_requests = metrics_.pending_requests)
+        pending_requests->dec();
       if (!invoke(this, f, x)) {
         // try again with error if first attempt failed
         auto msg = make_message(
@@ -826,13 +845,14 @@ invoke_message_result scheduled_actor::consume(mailbox_element& x) {
     // Handle multiplexed responses.
     if (x.mid.is_response()) {
       auto invoke = select_invoke_fun();
-      auto mrh = multiplexed_responses_.find(x.mid);
+      auto mrh = multiplexed_responses_.take(x.mid);
       // neither awaited nor multiplexed, probably an expired timeout
-      if (mrh == multiplexed_responses_.end())
+      if (!mrh)
         return invoke_message_result::dropped;
-      auto bhvr = std::move(mrh->second.first);
-      mrh->second.second.dispose(); // Stop the timeout.
-      multiplexed_responses_.erase(mrh);
+      auto bhvr = std::move(mrh->first);
+      mrh->second.dispose(); // Stop the timeout.
+      if (auto* pending_requests = metrics_.pending_requests)
+        pending_requests->dec();
       if (!invoke(this, bhvr, x)) {
         log::core::debug("got unexpected_response");
         auto msg = make_message(
@@ -1228,7 +1248,7 @@ void scheduled_actor::close_mailbox(const error& reason) {
   if (!mailbox().closed())
     dropped += mailbox().close(reason);
   if (dropped > 0 && metrics_.mailbox_size)
-    metrics_.mailbox_size->dec(static_cast<int64_t>(dropped));
+    metrics_.mailbox_size.dec(static_cast<int64_t>(dropped));
 }
 
 void scheduled_actor::force_close_mailbox() {
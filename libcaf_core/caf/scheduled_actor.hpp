@@ -14,6 +14,7 @@
 #include "caf/detail/behavior_stack.hpp"
 #include "caf/detail/core_export.hpp"
 #include "caf/detail/default_mailbox.hpp"
+#include "caf/detail/message_id_map.hpp"
 #include "caf/detail/stream_bridge.hpp"
 #include "caf/disposable.hpp"
 #include "caf/error.hpp"
@@ -699,7 +700,7 @@ protected:
   std::forward_list<pending_response> awaited_responses_;
 
   /// Stores callbacks for multiplexed responses.
-  unordered_flat_map<message_id, std::pair<behavior, disposable>>
+  detail::message_id_map<std::pair<behavior, disposable>>
     multiplexed_responses_;
 
   /// Customization point for setting a default `message` callback.
@@ -783,16 +784,30 @@ private:
   /// Places all messages from the `stash_` back into the mailbox.
   void unstash();
 
+  /// Buffers the samples for the histograms in `metrics_` while the actor
+  /// processes messages in `resume`.
+  struct metrics_batch {
+    explicit metrics_batch(telemetry::actor_metrics& metrics) noexcept
+      : processing_time(metrics.processing_time),
+        mailbox_time(metrics.mailbox_time) {
+      // nop
+    }
+
+    telemetry::dbl_histogram::batch processing_time;
+    telemetry::dbl_histogram::batch mailbox_time;
+  };
+
   template <class F>
-  activation_result run_with_metrics(mailbox_element& x, F body) {
+  activation_result
+  run_with_metrics(mailbox_element& x, metrics_batch& batch, F body) {
     if (metrics_.mailbox_time) {
       auto t0 = std::chrono::steady_clock::now();
       auto mbox_time = x.seconds_until(t0);
       auto res = body();
       if (res != activation_result::skipped) {
-        telemetry::timer::observe(metrics_.processing_time, t0);
-        metrics_.mailbox_time->observe(mbox_time);
-        metrics_.mailbox_size->dec();
+        telemetry::timer::observe(batch.processing_time, t0);
+        batch.mailbox_time.observe(mbox_time);
+        metrics_.mailbox_size.dec();
       }
       return res;
     } else {
@@ -802,6 +817,9 @@ private:
 
   // -- cleanup ----------------------------------------------------------------
 
+  /// Drops all awaited and multiplexed response handlers.
+  void clear_response_handlers();
+
   void close_mailbox(const error& reason);
 
   void force_close_mailbox() final;
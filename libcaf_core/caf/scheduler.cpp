@@ -10,22 +10,35 @@
 #include "caf/config.hpp"
 #include "caf/defaults.hpp"
 #include "caf/detail/assert.hpp"
+#include "caf/detail/chase_lev_deque.hpp"
 #include "caf/detail/cleanup_and_release.hpp"
+#include "caf/detail/cpu_topology.hpp"
 #include "caf/detail/default_thread_count.hpp"
 #include "caf/detail/double_ended_queue.hpp"
+#include "caf/detail/eventcount.hpp"
+#include "caf/detail/mpmc_ring.hpp"
+#include "caf/log/system.hpp"
 #include "caf/logger.hpp"
 #include "caf/scheduled_actor.hpp"
 #include "caf/scoped_actor.hpp"
 #include "caf/send.hpp"
+#include "caf/telemetry/metric_registry.hpp"
 #include "caf/thread_owner.hpp"
 
+#include <array>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <fstream>
 #include <ios>
 #include <iostream>
+#include <limits>
+#include <map>
 #include <memory>
+#include <optional>
 #include <random>
 #include <thread>
+#include <utility>
 
 namespace caf {
 
@@ -36,6 +49,238 @@ namespace {
 // Thread-local flag used by shutdown_helper to signal the worker to stop.
 thread_local bool stop_worker = false;
 
+// -- topology-aware placement of work stealing workers ------------------------
+
+/// Computes CPU assignments and steal orders for work stealing workers.
+class worker_placement {
+public:
+  worker_placement(const actor_system_config& cfg, size_t num_workers) {
+    topology_aware_ = get_or(cfg, "caf.work-stealing.topology-aware",
+                             defaults::work_stealing::topology_aware);
+    pin_workers_ = get_or(cfg, "caf.work-stealing.pin-workers",
+                          defaults::work_stealing::pin_workers);
+    if (!topology_aware_ && !pin_workers_)
+      return;
+    topology_ = detail::cpu_topology::load();
+    if (topology_.empty() || num_workers == 0) {
+      topology_aware_ = false;
+      pin_workers_ = false;
+      return;
+    }
+    // Spread the workers evenly over all CPUs. Since the topology orders CPUs
+    // by node and L3 domain, neighboring workers share caches where possible.
+    const auto& cpus = topology_.cpus();
+    for (size_t id = 0; id < num_workers; ++id)
+      worker_cpus_.push_back(&cpus[id * cpus.size() / num_workers]);
+    // Group victims by distance for each worker.
+    victims_.resize(num_workers);
+    for (size_t id = 0; id < num_workers; ++id) {
+      auto& tiers = victims_[id];
+      for (size_t other = 0; other < num_workers; ++other) {
+        if (other == id)
+          continue;
+        auto dist = detail::cpu_topology::distance(*worker_cpus_[id],
+                                                   *worker_cpus_[other]);
+        tiers[dist].push_back(other);
+      }
+    }
+    // Map each CPU to the workers on its node for routing external jobs.
+    for (size_t id = 0; id < num_workers; ++id)
+      node_workers_[worker_cpus_[id]->node].push_back(id);
+    for (const auto& cpu : cpus) {
+      if (cpu_nodes_.size() <= cpu.id)
+        cpu_nodes_.resize(cpu.id + 1, no_node);
+      if (node_workers_.count(cpu.node) != 0)
+        cpu_nodes_[cpu.id] = cpu.node;
+    }
+  }
+
+  /// Number of distinct distances between two workers.
+  static constexpr size_t num_tiers = detail::cpu_topology::remote + 1;
+
+  using victim_tiers = std::array<std::vector<size_t>, num_tiers>;
+
+  /// Returns whether workers steal and receive jobs based on the topology.
+  bool topology_aware() const noexcept {
+    return topology_aware_;
+  }
+
+  /// Binds the calling thread to the CPU assigned to given worker.
+  void pin(size_t worker_id) const {
+    if (pin_workers_ && !detail::cpu_topology::pin_this_thread(
+                          worker_cpus_[worker_id]->id))
+      log::system::warning("failed to pin worker {} to CPU {}", worker_id,
+                         worker_cpus_[worker_id]->id);
+  }
+
+  /// Returns the victims of given worker, grouped by their distance.
+  const victim_tiers& victims(size_t worker_id) const {
+    return victims_[worker_id];
+  }
+
+  /// Picks a worker on the NUMA node of the calling thread.
+  /// @returns the ID of the worker or `nullopt` if no worker is on this node.
+  std::optional<size_t> local_worker(size_t round_robin) const {
+    auto cpu = detail::cpu_topology::current_cpu();
+    if (!cpu || *cpu >= cpu_nodes_.size() || cpu_nodes_[*cpu] == no_node)
+      return std::nullopt;
+    const auto& candidates = node_workers_.find(cpu_nodes_[*cpu])->second;
+    return candidates[round_robin % candidates.size()];
+  }
+
+private:
+  static constexpr size_t no_node = std::numeric_limits<size_t>::max();
+
+  bool topology_aware_ = false;
+
+  bool pin_workers_ = false;
+
+  detail::cpu_topology topology_;
+
+  /// Stores the assigned CPU for each worker.
+  std::vector<const detail::cpu_info*> worker_cpus_;
+
+  /// Stores the victims for each worker.
+  std::vector<victim_tiers> victims_;
+
+  /// Maps NUMA nodes to the workers running on them.
+  std::map<size_t, std::vector<size_t>> node_workers_;
+
+  /// Maps CPU IDs to NUMA nodes that have at least one worker.
+  std::vector<size_t> cpu_nodes_;
+};
+
+// -- next-to-run slot for work stealing workers -------------------------------
+
+/// Holds the job that a worker woke up most recently, e.g., the receiver of a
+/// message sent by the actor that currently runs. The worker runs this job
+/// right after the current one without going through its queue. To avoid
+/// starving other jobs, the worker may take at most `max_polls` jobs in a row
+/// from this slot before it must take the next job from its queue.
+class lifo_slot {
+public:
+  explicit lifo_slot(size_t max_polls) : max_polls_(max_polls) {
+    // nop
+  }
+
+  bool enabled() const noexcept {
+    return max_polls_ > 0;
+  }
+
+  /// Stores `job` in the slot and returns the previous job (if any).
+  resumable* exchange(resumable* job) noexcept {
+    return std::exchange(job_, job);
+  }
+
+  /// Takes the job from the slot unless the worker used up its budget.
+  resumable* take() noexcept {
+    if (job_ == nullptr || polls_ >= max_polls_)
+      return nullptr;
+    ++polls_;
+    return std::exchange(job_, nullptr);
+  }
+
+  /// Removes the job from the slot (if any) and resets the budget. Workers
+  /// call this function before taking the next job from their queue.
+  resumable* release() noexcept {
+    polls_ = 0;
+    return std::exchange(job_, nullptr);
+  }
+
+private:
+  resumable* job_ = nullptr;
+  size_t polls_ = 0;
+  size_t max_polls_;
+};
+
+// -- adaptive parking of idle workers -----------------------------------------
+
+/// Upper bounds for the park duration histogram in seconds.
+constexpr double park_duration_buckets[] = {
+  .00001, // 10us
+  .0001,  // 100us
+  .001,   // 1ms
+  .01,    // 10ms
+  .1,     // 100ms
+  1.,     // 1s
+  10.,    // 10s
+};
+
+/// Metrics for workers that park when running out of work.
+struct idle_metrics {
+  explicit idle_metrics(telemetry::metric_registry& reg) {
+    wakeups = reg.counter_singleton("caf.scheduler", "worker-wakeups",
+                                    "Number of times a parked worker woke up.");
+    spurious_wakeups = reg.counter_singleton(
+      "caf.scheduler", "worker-spurious-wakeups",
+      "Number of times a parked worker woke up without finding a job.");
+    park_duration = reg.histogram_singleton<double>(
+      "caf.scheduler", "worker-park-duration", park_duration_buckets,
+      "Time a worker stays parked before waking up.", "seconds");
+  }
+
+  /// Counts how often parked workers woke up.
+  telemetry::int_counter* wakeups;
+
+  /// Counts how often parked workers woke up without finding a job.
+  telemetry::int_counter* spurious_wakeups;
+
+  /// Samples how long workers stay parked.
+  telemetry::dbl_histogram* park_duration;
+};
+
+/// Tracks the success rate of recent steal attempts as an exponentially
+/// weighted moving average. Idle workers spin longer while stealing succeeds
+/// frequently, i.e., under bursty load, and park quickly otherwise.
+class steal_rate {
+public:
+  explicit steal_rate(size_t max_spins)
+    : min_spins_(max_spins / 16), max_spins_(max_spins) {
+    // nop
+  }
+
+  /// Updates the moving average after a steal attempt.
+  void record(bool success) noexcept {
+    rate_ = rate_ - rate_ / 8 + (success ? scale / 8 : 0);
+  }
+
+  /// Returns how many steal attempts an idle worker makes before parking.
+  size_t spin_budget() const noexcept {
+    return min_spins_ + (max_spins_ - min_spins_) * rate_ / scale;
+  }
+
+private:
+  static constexpr size_t scale = 1024;
+
+  size_t rate_ = scale / 2;
+  size_t min_spins_;
+  size_t max_spins_;
+};
+
+/// Parks the calling worker on `idle` until `recheck` returns a job.
+template <class Recheck>
+resumable* park(detail::eventcount& idle, idle_metrics& metrics,
+                Recheck recheck) {
+  for (;;) {
+    // Re-check all queues after announcing ourselves as waiter to avoid lost
+    // wakeups.
+    auto key = idle.prepare_wait();
+    if (auto* job = recheck()) {
+      idle.cancel_wait();
+      return job;
+    }
+    auto t0 = std::chrono::steady_clock::now();
+    idle.wait(key);
+    auto parked = std::chrono::steady_clock::now() - t0;
+    metrics.park_duration->observe(
+      std::chrono::duration<double>{parked}.count());
+    metrics.wakeups->inc();
+    if (auto* job = recheck())
+      return job;
+    metrics.spurious_wakeups->inc();
+  }
+}
+
 // -- work stealing scheduler implementation -----------------------------------
 
 namespace work_stealing {
@@ -74,14 +319,17 @@ struct worker_data {
           get_or(p->config(), "caf.work-stealing.relaxed-steal-interval",
                  defaults::work_stealing::relaxed_steal_interval),
           get_or(p->config(), "caf.work-stealing.relaxed-sleep-duration",
-                 defaults::work_stealing::relaxed_sleep_duration)}}} {
+                 defaults::work_stealing::relaxed_sleep_duration)}}},
+      max_lifo_polls(get_or(p->config(), "caf.work-stealing.max-lifo-polls",
+                            defaults::work_stealing::max_lifo_polls)) {
     // nop
   }
 
   worker_data(const worker_data& other)
     : rengine(std::random_device{}()),
       uniform(other.uniform),
-      strategies(other.strategies) {
+      strategies(other.strategies),
+      max_lifo_polls(other.max_lifo_polls) {
     // nop
   }
 
@@ -93,16 +341,29 @@ struct worker_data {
   std::default_random_engine rengine;
   std::uniform_int_distribution<size_t> uniform;
   std::array<poll_strategy, 3> strategies;
+
+  // Maximum number of consecutive jobs from the next-to-run slot.
+  size_t max_lifo_polls;
 };
 
+class worker;
+
+// Points to the work stealing worker running on the current thread (if any).
+thread_local worker* current_worker = nullptr;
+
 /// Implementation of the work stealing worker class.
 class worker : public scheduler {
 public:
   using job_ptr = resumable*;
 
   template <class SchedulerImpl>
-  worker(size_t worker_id, SchedulerImpl*, const worker_data& init)
-    : id_(worker_id), data_(init) {
+  worker(size_t worker_id, SchedulerImpl* parent, const worker_data& init)
+    : id_(worker_id),
+      data_(init),
+      lifo_(init.max_lifo_polls),
+      idle_(parent->idle()),
+      metrics_(parent->metrics()),
+      rate_(init.strategies[0].attempts) {
     // nop
   }
 
@@ -132,11 +393,22 @@ public:
   void schedule(job_ptr job, uint64_t) override {
     CAF_ASSERT(job != nullptr);
     data_.queue.append(job);
+    notify_idle();
   }
 
   void delay(job_ptr job, uint64_t) override {
     CAF_ASSERT(job != nullptr);
+    // Jobs woken up by the running job go to the next-to-run slot. However, a
+    // job that re-schedules itself goes to the queue to give others a chance.
+    if (lifo_.enabled() && current_worker == this && job != running_) {
+      if (auto* prev = lifo_.exchange(job)) {
+        data_.queue.prepend(prev);
+        notify_idle();
+      }
+      return;
+    }
     data_.queue.prepend(job);
+    notify_idle();
   }
 
   size_t id() const {
@@ -152,6 +424,12 @@ public:
   }
 
 private:
+  // Wakes up a parked worker when using the adaptive idle strategy.
+  void notify_idle() {
+    if (idle_ != nullptr)
+      idle_->notify_one();
+  }
+
   // Goes on a raid in quest for a shiny new job.
   template <typename Parent>
   resumable* try_steal(Parent* p) {
@@ -159,6 +437,19 @@ private:
       // You can't steal from yourself, can you?
       return nullptr;
     }
+    // Prefer victims that are close to us in the CPU topology and only go to
+    // more distant workers if the nearby ones have nothing to steal.
+    if (p->placement().topology_aware()) {
+      for (const auto& tier : p->placement().victims(id_)) {
+        if (tier.empty())
+          continue;
+        auto pick = std::uniform_int_distribution<size_t>{0, tier.size() - 1};
+        auto* victim = p->worker_by_id(tier[pick(data_.rengine)]);
+        if (auto* job = victim->data_.queue.try_take_tail())
+          return job;
+      }
+      return nullptr;
+    }
     // Roll the dice to pick a victim other than ourselves.
     auto victim = data_.uniform(data_.rengine);
     if (victim == this->id())
@@ -167,8 +458,45 @@ private:
     return p->worker_by_id(victim)->data_.queue.try_take_tail();
   }
 
+  // Visits all other workers once and returns the first job found.
+  template <typename Parent>
+  resumable* try_steal_any(Parent* p) {
+    auto num_workers = p->num_workers();
+    for (size_t i = 1; i < num_workers; ++i) {
+      auto* victim = p->worker_by_id((id_ + i) % num_workers);
+      if (auto* job = victim->data_.queue.try_take_tail())
+        return job;
+    }
+    return nullptr;
+  }
+
+  // Spins for a while, adapting the number of steal attempts to the recent
+  // success rate, and then parks the worker until another thread schedules a
+  // job.
+  template <typename Parent>
+  resumable* adaptive_dequeue(Parent* parent) {
+    if (auto* job = data_.queue.try_take_head())
+      return job;
+    for (size_t i = 0, n = rate_.spin_budget(); i < n; ++i) {
+      auto* job = try_steal(parent);
+      rate_.record(job != nullptr);
+      if (job != nullptr)
+        return job;
+      if (auto* job = data_.queue.try_take_head())
+        return job;
+      std::this_thread::yield();
+    }
+    return park(*idle_, *metrics_, [this, parent]() -> resumable* {
+      if (auto* job = data_.queue.try_take_head())
+        return job;
+      return try_steal_any(parent);
+    });
+  }
+
   template <typename Parent>
   resumable* policy_dequeue(Parent* parent) {
+    if (idle_ != nullptr)
+      return adaptive_dequeue(parent);
     // We wait for new jobs by polling our external queue: first, we assume an
     // active work load on the machine and perform aggressive/moderate polling
     // by using the parameters for the first two strategies. When not finding
@@ -199,18 +527,38 @@ private:
     }
   }
 
+  template <typename Parent>
+  resumable* next_job(Parent* parent) {
+    if (auto* job = lifo_.take())
+      return job;
+    // Move a job that exceeded its budget to the back of the queue.
+    if (auto* job = lifo_.release())
+      data_.queue.unsafe_append(job);
+    return policy_dequeue(parent);
+  }
+
   template <typename Parent>
   void run(Parent* parent) {
     CAF_SET_LOGGER_SYS(&parent->system());
+    parent->placement().pin(id_);
+    current_worker = this;
     // scheduling loop
     for (;;) {
-      auto job = policy_dequeue(parent);
+      auto job = next_job(parent);
       CAF_ASSERT(job->pinned_scheduler() == nullptr);
+      running_ = job;
       job->resume(this, resumable::default_event_id);
+      running_ = nullptr;
       intrusive_ptr_release(job);
       if (stop_worker)
-        return;
+        break;
     }
+    // Make a pending job available to other workers before leaving.
+    if (auto* job = lifo_.release()) {
+      data_.queue.append(job);
+      notify_idle();
+    }
+    current_worker = nullptr;
   }
 
   // The worker's thread.
@@ -221,15 +569,39 @@ private:
 
   // Policy-specific data.
   worker_data data_;
+
+  // The job that runs next, bypassing the queue.
+  lifo_slot lifo_;
+
+  // The job that currently runs on this worker.
+  resumable* running_ = nullptr;
+
+  // Parking lot for idle workers if using the adaptive idle strategy.
+  detail::eventcount* idle_;
+
+  // Metrics for the adaptive idle strategy.
+  idle_metrics* metrics_;
+
+  // Success rate of recent steal attempts.
+  steal_rate rate_;
 };
 
 /// Policy-based implementation of the scheduler base class.
 class scheduler_impl : public scheduler {
 public:
-  explicit scheduler_impl(actor_system& sys) : sys_(&sys) {
-    auto& cfg = sys.config();
-    num_workers_ = get_or(cfg, "caf.scheduler.max-threads",
-                          detail::default_thread_count());
+  explicit scheduler_impl(actor_system& sys)
+    : num_workers_(get_or(sys.config(), "caf.scheduler.max-threads",
+                          detail::default_thread_count())),
+      placement_(sys.config(), num_workers_),
+      sys_(&sys) {
+    auto strategy = get_or(sys.config(), "caf.work-stealing.idle-strategy",
+                           defaults::work_stealing::idle_strategy);
+    if (strategy == "adaptive")
+      metrics_.emplace(sys.metrics());
+    else if (strategy != "polling")
+      log::system::warning("unrecognized idle strategy '{}', falling back to "
+                           "'polling'",
+                           strategy);
   }
 
   using worker_type = worker;
@@ -252,10 +624,34 @@ public:
     return num_workers_;
   }
 
+  const worker_placement& placement() const noexcept {
+    return placement_;
+  }
+
+  /// Returns the parking lot for idle workers or `nullptr` when using the
+  /// polling idle strategy.
+  detail::eventcount* idle() noexcept {
+    return metrics_ ? &idle_ : nullptr;
+  }
+
+  /// Returns the metrics for idle workers or `nullptr` when using the polling
+  /// idle strategy.
+  idle_metrics* metrics() noexcept {
+    return metrics_ ? &*metrics_ : nullptr;
+  }
+
   // -- implementation of scheduler interface ----------------------------------
 
   void schedule(resumable* ptr, uint64_t) override {
-    auto w = this->worker_by_id(next_worker++ % num_workers_);
+    auto index = next_worker++;
+    if (placement_.topology_aware()) {
+      // Keep the job on the NUMA node of the calling thread.
+      if (auto id = placement_.local_worker(index)) {
+        worker_by_id(*id)->schedule(ptr, resumable::default_event_id);
+        return;
+      }
+    }
+    auto w = this->worker_by_id(index % num_workers_);
     w->schedule(ptr, resumable::default_event_id);
   }
 
@@ -350,12 +746,485 @@ private:
   /// Configured number of workers.
   size_t num_workers_ = 0;
 
+  /// Assigns CPUs and victims to workers.
+  worker_placement placement_;
+
+  /// Parking lot for idle workers when using the adaptive idle strategy.
+  detail::eventcount idle_;
+
+  /// Metrics for idle workers, only present when using the adaptive idle
+  /// strategy.
+  std::optional<idle_metrics> metrics_;
+
   /// Reference to the host system.
   actor_system* sys_ = nullptr;
 };
 
 } // namespace work_stealing
 
+// -- lock-free work stealing scheduler implementation -------------------------
+
+namespace lock_free_stealing {
+
+class scheduler_impl;
+
+/// Implementation of the lock-free work stealing worker class. Each worker owns
+/// a Chase-Lev deque for jobs that it schedules itself and an inbox for jobs
+/// that other threads assign to it.
+class worker : public scheduler {
+public:
+  using job_ptr = resumable*;
+
+  worker(size_t worker_id, scheduler_impl* parent, size_t num_workers,
+         size_t spin_attempts, size_t max_lifo_polls)
+    : id_(worker_id),
+      parent_(parent),
+      rengine_(std::random_device{}()),
+      // No need to worry about wrap-around; if `num_workers < 2`, `uniform_`
+      // will not be used anyway.
+      uniform_(0, num_workers - 2),
+      rate_(spin_attempts),
+      lifo_(max_lifo_polls) {
+    // nop
+  }
+
+  worker(const worker&) = delete;
+
+  worker& operator=(const worker&) = delete;
+
+  void start() override {
+    // nop
+  }
+
+  void stop() override {
+    // nop
+  }
+
+  bool is_system_scheduler() const noexcept final {
+    return true;
+  }
+
+  void schedule(job_ptr job, uint64_t) override;
+
+  void delay(job_ptr job, uint64_t) override;
+
+  /// Returns whether the calling thread is the thread of this worker.
+  bool is_current() const noexcept;
+
+  size_t id() const noexcept {
+    return id_;
+  }
+
+  std::thread& get_thread() noexcept {
+    return this_thread_;
+  }
+
+  void launch();
+
+  /// Tries to take a job from another thread.
+  resumable* try_steal_from_this() {
+    if (auto* job = deque_.steal())
+      return job;
+    return take_from_inbox(false);
+  }
+
+  /// Returns whether this worker has any job in its queues.
+  bool has_jobs() const noexcept {
+    return !deque_.empty_hint() || inbox_size_.load() > 0;
+  }
+
+  /// Removes all remaining jobs after the worker thread has terminated.
+  template <class UnaryFunction>
+  void drain(UnaryFunction f) {
+    for (auto* job = deque_.pop(); job != nullptr; job = deque_.pop())
+      f(job);
+    for (auto* job = take_from_inbox(true); job != nullptr;
+         job = take_from_inbox(true))
+      f(job);
+  }
+
+private:
+  resumable* take_from_inbox(bool from_head) {
+    if (inbox_size_.load(std::memory_order_acquire) == 0)
+      return nullptr;
+    auto* job = from_head ? inbox_.try_take_head() : inbox_.try_take_tail();
+    if (job != nullptr)
+      inbox_size_.fetch_sub(1, std::memory_order_relaxed);
+    return job;
+  }
+
+  // Goes on a raid in quest for a shiny new job.
+  resumable* try_steal();
+
+  // Visits all other workers once and returns the first job found.
+  resumable* try_steal_any();
+
+  resumable* dequeue();
+
+  void run();
+
+  // Jobs scheduled by the worker itself. Only this worker pushes and pops,
+  // other workers may steal from the top.
+  detail::chase_lev_deque<resumable> deque_;
+
+  // Jobs scheduled to this worker from other threads.
+  detail::double_ended_queue<resumable> inbox_;
+
+  // Allows other threads to check the inbox without acquiring its lock.
+  std::atomic<size_t> inbox_size_ = 0;
+
+  // The worker's thread.
+  std::thread this_thread_;
+
+  // The worker's ID received from scheduler.
+  size_t id_;
+
+  // Points to the scheduler that owns this worker.
+  scheduler_impl* parent_;
+
+  // Needed to generate pseudo random numbers.
+  std::default_random_engine rengine_;
+  std::uniform_int_distribution<size_t> uniform_;
+
+  // Success rate of recent steal attempts.
+  steal_rate rate_;
+
+  // Counts dequeue operations in order to check the inbox periodically.
+  size_t ticks_ = 0;
+
+  // The job that runs next, bypassing the deque.
+  lifo_slot lifo_;
+
+  // The job that currently runs on this worker.
+  resumable* running_ = nullptr;
+};
+
+// Points to the lock-free worker running on the current thread (if any).
+thread_local worker* current_worker = nullptr;
+
+/// Implementation of the scheduler that manages lock-free workers.
+class scheduler_impl : public scheduler {
+public:
+  using worker_type = worker;
+
+  explicit scheduler_impl(actor_system& sys)
+    : num_workers_(get_or(sys.config(), "caf.scheduler.max-threads",
+                          detail::default_thread_count())),
+      spin_attempts_(
+        get_or(sys.config(), "caf.work-stealing.aggressive-poll-attempts",
+               defaults::work_stealing::aggressive_poll_attempts)),
+      max_lifo_polls_(get_or(sys.config(), "caf.work-stealing.max-lifo-polls",
+                             defaults::work_stealing::max_lifo_polls)),
+      placement_(sys.config(), num_workers_),
+      metrics_(sys.metrics()),
+      sys_(&sys) {
+    // nop
+  }
+
+  worker_type* worker_by_id(size_t x) {
+    return workers_[x].get();
+  }
+
+  // -- properties -------------------------------------------------------------
+
+  actor_system& system() {
+    return *sys_;
+  }
+
+  size_t num_workers() const noexcept {
+    return num_workers_;
+  }
+
+  /// Parking lot for idle workers.
+  detail::eventcount& idle() noexcept {
+    return idle_;
+  }
+
+  /// Metrics for idle workers.
+  idle_metrics& metrics() noexcept {
+    return metrics_;
+  }
+
+  const worker_placement& placement() const noexcept {
+    return placement_;
+  }
+
+  // -- implementation of scheduler interface ----------------------------------
+
+  void schedule(resumable* ptr, uint64_t) override {
+    // Jobs scheduled from one of our workers stay local to avoid contention.
+    if (auto* w = current_worker; w != nullptr && owns(w)) {
+      w->schedule(ptr, resumable::default_event_id);
+      return;
+    }
+    auto index = next_worker++;
+    if (placement_.topology_aware()) {
+      // Keep the job on the NUMA node of the calling thread.
+      if (auto id = placement_.local_worker(index)) {
+        worker_by_id(*id)->schedule(ptr, resumable::default_event_id);
+        return;
+      }
+    }
+    auto w = this->worker_by_id(index % num_workers_);
+    w->schedule(ptr, resumable::default_event_id);
+  }
+
+  void delay(resumable* what, uint64_t) override {
+    schedule(what, resumable::default_event_id);
+  }
+
+  void start() override {
+    workers_.reserve(num_workers_);
+    for (size_t i = 0; i < num_workers_; ++i)
+      workers_.emplace_back(std::make_unique<worker_type>(
+        i, this, num_workers_, spin_attempts_, max_lifo_polls_));
+    for (auto& w : workers_)
+      w->launch();
+  }
+
+  void stop() override {
+    // Shutdown workers.
+    class shutdown_helper : public resumable, public ref_counted {
+    public:
+      void resume(scheduler* ptr, uint64_t) override {
+        CAF_ASSERT(ptr != nullptr);
+        stop_worker = true;
+        std::unique_lock<std::mutex> guard(mtx);
+        last_worker = ptr;
+        cv.notify_all();
+      }
+
+      void ref_resumable() const noexcept final {
+        ref();
+      }
+
+      void deref_resumable() const noexcept final {
+        deref();
+      }
+
+      shutdown_helper() : last_worker(nullptr) {
+        // nop
+      }
+
+      std::mutex mtx;
+      std::condition_variable cv;
+      scheduler* last_worker;
+    };
+    // Use a set to keep track of remaining workers.
+    shutdown_helper sh;
+    std::set<worker_type*> alive_workers;
+    for (size_t i = 0; i < num_workers_; ++i)
+      alive_workers.insert(worker_by_id(i));
+    while (!alive_workers.empty()) {
+      // Add a reference before scheduling. The worker will release this
+      // reference after processing the shutdown_helper.
+      sh.ref();
+      (*alive_workers.begin())->schedule(&sh, resumable::default_event_id);
+      // Since jobs can be stolen, we cannot assume that we have actually shut
+      // down the worker we've enqueued sh to.
+      {
+        std::unique_lock<std::mutex> guard(sh.mtx);
+        sh.cv.wait(guard, [&] { return sh.last_worker != nullptr; });
+      }
+      alive_workers.erase(static_cast<worker_type*>(sh.last_worker));
+      sh.last_worker = nullptr;
+    }
+    // Wait until all workers are done.
+    for (auto& w : workers_) {
+      w->get_thread().join();
+    }
+    // Run cleanup code for each resumable.
+    for (auto& w : workers_)
+      w->drain(detail::cleanup_and_release);
+  }
+
+  bool is_system_scheduler() const noexcept final {
+    return true;
+  }
+
+private:
+  bool owns(const worker_type* w) const noexcept {
+    return w->id() < workers_.size() && workers_[w->id()].get() == w;
+  }
+
+  /// Set of workers.
+  std::vector<std::unique_ptr<worker_type>> workers_;
+
+  /// Next worker.
+  std::atomic<size_t> next_worker = 0;
+
+  /// Parking lot for idle workers.
+  detail::eventcount idle_;
+
+  /// Configured number of workers.
+  size_t num_workers_ = 0;
+
+  /// Configured number of steal rounds before parking a worker.
+  size_t spin_attempts_ = 0;
+
+  /// Configured number of consecutive jobs from the next-to-run slot.
+  size_t max_lifo_polls_ = 0;
+
+  /// Assigns CPUs and victims to workers.
+  worker_placement placement_;
+
+  /// Metrics for idle workers.
+  idle_metrics metrics_;
+
+  /// Reference to the host system.
+  actor_system* sys_ = nullptr;
+};
+
+bool worker::is_current() const noexcept {
+  return current_worker == this;
+}
+
+void worker::schedule(job_ptr job, uint64_t) {
+  CAF_ASSERT(job != nullptr);
+  if (is_current()) {
+    deque_.push(job);
+  } else {
+    inbox_.append(job);
+    inbox_size_.fetch_add(1, std::memory_order_release);
+  }
+  parent_->idle().notify_one();
+}
+
+void worker::delay(job_ptr job, uint64_t) {
+  CAF_ASSERT(job != nullptr);
+  // Jobs woken up by the running job go to the next-to-run slot. However, a
+  // job that re-schedules itself goes to the deque to give others a chance.
+  // Putting a job into the slot does not wake up idle workers, since we are
+  // going to run it shortly.
+  if (lifo_.enabled() && is_current() && job != running_) {
+    if (auto* prev = lifo_.exchange(job)) {
+      deque_.push(prev);
+      parent_->idle().notify_one();
+    }
+    return;
+  }
+  // Pushing to the bottom of the deque makes the job the next one to run.
+  schedule(job, resumable::default_event_id);
+}
+
+void worker::launch() {
+  CAF_ASSERT(this_thread_.get_id() == std::thread::id{});
+  this_thread_ = parent_->system().launch_thread("caf.worker",
+                                                 thread_owner::scheduler,
+                                                 [this] { run(); });
+}
+
+resumable* worker::try_steal() {
+  auto num_workers = parent_->num_workers();
+  if (num_workers < 2) {
+    // You can't steal from yourself, can you?
+    return nullptr;
+  }
+  // Prefer victims that are close to us in the CPU topology.
+  if (parent_->placement().topology_aware()) {
+    for (const auto& tier : parent_->placement().victims(id_)) {
+      if (tier.empty())
+        continue;
+      auto pick = std::uniform_int_distribution<size_t>{0, tier.size() - 1};
+      auto* victim = parent_->worker_by_id(tier[pick(rengine_)]);
+      if (auto* job = victim->try_steal_from_this())
+        return job;
+    }
+    return nullptr;
+  }
+  // Roll the dice to pick a victim other than ourselves.
+  auto victim = uniform_(rengine_);
+  if (victim == id_)
+    victim = num_workers - 1;
+  return parent_->worker_by_id(victim)->try_steal_from_this();
+}
+
+resumable* worker::try_steal_any() {
+  auto num_workers = parent_->num_workers();
+  if (num_workers < 2)
+    return nullptr;
+  auto offset = uniform_(rengine_);
+  for (size_t i = 0; i < num_workers; ++i) {
+    auto victim_id = (offset + i) % num_workers;
+    if (victim_id == id_)
+      continue;
+    auto* victim = parent_->worker_by_id(victim_id);
+    // A failed steal may also indicate a lost race, so keep trying as long as
+    // the victim appears to have jobs. Otherwise, we could go to sleep while
+    // there is still work left.
+    while (victim->has_jobs())
+      if (auto* job = victim->try_steal_from_this())
+        return job;
+  }
+  return nullptr;
+}
+
+resumable* worker::dequeue() {
+  if (auto* job = lifo_.take())
+    return job;
+  if (auto* job = lifo_.release()) {
+    // The job exceeded its budget: run another job first if there is one.
+    auto* other = take_from_inbox(true);
+    if (other == nullptr)
+      other = deque_.pop();
+    if (other == nullptr)
+      return job;
+    deque_.push(job);
+    parent_->idle().notify_one();
+    return other;
+  }
+  // Check the inbox periodically to make sure that jobs from other threads
+  // cannot starve if the worker keeps re-scheduling jobs locally.
+  if (++ticks_ % 61 == 0) {
+    if (auto* job = take_from_inbox(true))
+      return job;
+  }
+  if (auto* job = deque_.pop())
+    return job;
+  if (auto* job = take_from_inbox(true))
+    return job;
+  // Try stealing for a while before parking. The number of attempts adapts
+  // to the recent success rate.
+  for (size_t i = 0, n = rate_.spin_budget(); i < n; ++i) {
+    auto* job = try_steal();
+    rate_.record(job != nullptr);
+    if (job != nullptr)
+      return job;
+    std::this_thread::yield();
+  }
+  // Park until another thread schedules a job.
+  return park(parent_->idle(), parent_->metrics(), [this]() -> resumable* {
+    if (auto* job = take_from_inbox(true))
+      return job;
+    return try_steal_any();
+  });
+}
+
+void worker::run() {
+  CAF_SET_LOGGER_SYS(&parent_->system());
+  parent_->placement().pin(id_);
+  current_worker = this;
+  // scheduling loop
+  for (;;) {
+    auto job = dequeue();
+    CAF_ASSERT(job->pinned_scheduler() == nullptr);
+    running_ = job;
+    job->resume(this, resumable::default_event_id);
+    running_ = nullptr;
+    intrusive_ptr_release(job);
+    if (stop_worker)
+      break;
+  }
+  // Make a pending job available to other workers before leaving.
+  if (auto* job = lifo_.release()) {
+    deque_.push(job);
+    parent_->idle().notify_one();
+  }
+  current_worker = nullptr;
+}
+
+} // namespace lock_free_stealing
+
 // -- work sharing scheduler implementation ------------------------------------
 
 namespace work_sharing {
@@ -439,9 +1308,16 @@ public:
 
   using worker_type = worker<scheduler_impl>;
 
-  using queue_type = std::list<resumable*>;
+  using ring_type = detail::mpmc_ring<resumable*>;
 
-  explicit scheduler_impl(actor_system& sys) : sys_(&sys) {
+  using overflow_type = std::deque<resumable*>;
+
+  /// Number of jobs that fit into the injection ring before the scheduler
+  /// spills jobs into the overflow queue.
+  static constexpr size_t ring_capacity = 4096;
+
+  explicit scheduler_impl(actor_system& sys)
+    : ring_(ring_capacity), metrics_(sys.metrics()), sys_(&sys) {
     auto& cfg = sys.config();
     num_workers_ = get_or(cfg, "caf.scheduler.max-threads",
                           detail::default_thread_count());
@@ -464,11 +1340,18 @@ public:
   // -- implementation of scheduler interface ----------------------------------
 
   void schedule(resumable* ptr, uint64_t) override {
-    queue_type l;
-    l.push_back(ptr);
-    std::unique_lock<std::mutex> guard(lock);
-    queue.splice(queue.end(), l);
-    cv.notify_one();
+    CAF_ASSERT(ptr != nullptr);
+    // Once jobs spilled into the overflow queue, new jobs must follow them
+    // until the workers have drained the overflow queue. Otherwise, jobs in
+    // the overflow queue could starve under sustained load.
+    if (overflow_size_.load(std::memory_order_acquire) > 0
+        || !ring_.try_push(ptr)) {
+      std::unique_lock guard{overflow_mtx_};
+      overflow_.push_back(ptr);
+      overflow_size_.fetch_add(1, std::memory_order_release);
+    }
+    // Only touches the futex if at least one worker is parked.
+    idle_.notify_one();
   }
 
   void delay(resumable* what, uint64_t) override {
@@ -543,11 +1426,9 @@ public:
   }
 
   resumable* dequeue() {
-    std::unique_lock<std::mutex> guard(lock);
-    cv.wait(guard, [&] { return !queue.empty(); });
-    resumable* job = queue.front();
-    queue.pop_front();
-    return job;
+    if (auto* job = try_dequeue())
+      return job;
+    return park(idle_, metrics_, [this] { return try_dequeue(); });
   }
 
 private:
@@ -555,30 +1436,50 @@ private:
     return workers_[x].get();
   }
 
+  /// Takes the next job from the ring or, if the ring is empty, from the
+  /// overflow queue. Returns `nullptr` if both are empty.
+  resumable* try_dequeue() {
+    resumable* job = nullptr;
+    if (ring_.try_pop(job))
+      return job;
+    if (overflow_size_.load(std::memory_order_acquire) == 0)
+      return nullptr;
+    std::unique_lock guard{overflow_mtx_};
+    if (overflow_.empty())
+      return nullptr;
+    job = overflow_.front();
+    overflow_.pop_front();
+    overflow_size_.fetch_sub(1, std::memory_order_release);
+    return job;
+  }
+
   template <class UnaryFunction>
   void foreach_central_resumable(UnaryFunction f) {
-    auto next = [&]() -> resumable* {
-      if (queue.empty()) {
-        return nullptr;
-      }
-      auto front = queue.front();
-      queue.pop_front();
-      return front;
-    };
-    std::unique_lock<std::mutex> guard(lock);
-    for (auto job = next(); job != nullptr; job = next()) {
+    for (auto* job = try_dequeue(); job != nullptr; job = try_dequeue())
       f(job);
-    }
   }
 
   /// Set of workers.
   std::vector<std::unique_ptr<worker_type>> workers_;
 
-  queue_type queue;
+  /// Lock-free queue for scheduled jobs.
+  ring_type ring_;
 
-  std::mutex lock;
+  /// Stores jobs that did not fit into the ring.
+  overflow_type overflow_;
 
-  std::condition_variable cv;
+  /// Protects `overflow_`.
+  std::mutex overflow_mtx_;
+
+  /// Number of jobs in `overflow_`. Allows workers and producers to skip the
+  /// mutex while the ring has enough room.
+  std::atomic<size_t> overflow_size_ = 0;
+
+  /// Allows idle workers to park until new jobs arrive.
+  detail::eventcount idle_;
+
+  /// Collects metrics for parked workers.
+  idle_metrics metrics_;
 
   /// Thread for managing timeouts and delayed messages.
   std::thread timer_;
@@ -600,6 +1501,11 @@ std::unique_ptr<scheduler> scheduler::make_work_stealing(actor_system& sys) {
   return std::make_unique<work_stealing::scheduler_impl>(sys);
 }
 
+std::unique_ptr<scheduler>
+scheduler::make_lock_free_work_stealing(actor_system& sys) {
+  return std::make_unique<lock_free_stealing::scheduler_impl>(sys);
+}
+
 std::unique_ptr<scheduler> scheduler::make_work_sharing(actor_system& sys) {
   return std::make_unique<work_sharing::scheduler_impl>(sys);
 }
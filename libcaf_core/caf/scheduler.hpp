@@ -19,6 +19,11 @@ public:
 
   static std::unique_ptr<scheduler> make_work_stealing(actor_system& sys);
 
+  /// Creates a work stealing scheduler that uses lock-free Chase-Lev deques
+  /// for its workers and parks idle workers instead of polling.
+  static std::unique_ptr<scheduler>
+  make_lock_free_work_stealing(actor_system& sys);
+
   static std::unique_ptr<scheduler> make_work_sharing(actor_system& sys);
 
   // -- constructors, destructors, and assignment operators --------------------
@@ -9,8 +9,10 @@
 #include "caf/actor_system_config.hpp"
 #include "caf/detail/latch.hpp"
 #include "caf/resumable.hpp"
+#include "caf/telemetry/metric_registry.hpp"
 
 #include <string>
+#include <thread>
 
 using namespace caf;
 using namespace std::literals;
@@ -102,9 +104,10 @@ OUTLINE("scheduling resumables") {
     }
   }
   EXAMPLES = R"(
-    |    sched    |
-    | sharing     |
-    | stealing    |
+    |    sched           |
+    | sharing            |
+    | stealing           |
+    | lock-free-stealing |
   )";
 }
 
@@ -167,8 +170,146 @@ OUTLINE("scheduling units that are awaiting") {
     }
   }
   EXAMPLES = R"(
-    |    sched    |
-    | sharing     |
-    | stealing    |
+    |    sched           |
+    | sharing            |
+    | stealing           |
+    | lock-free-stealing |
+  )";
+}
+
+OUTLINE("topology-aware work stealing") {
+  GIVEN("an actor system using the <sched> scheduler with topology awareness") {
+    auto sched = block_parameters<std::string>();
+    actor_system_config cfg;
+    cfg.set("caf.scheduler.policy", sched);
+    cfg.set("caf.scheduler.max-threads", 4);
+    cfg.set("caf.scheduler.max-throughput", 5);
+    cfg.set("caf.work-stealing.topology-aware", true);
+    cfg.set("caf.work-stealing.pin-workers", true);
+    auto sys = std::make_unique<actor_system>(cfg);
+    WHEN("scheduling multiple resumables") {
+      auto workers = std::vector<intrusive_ptr<testee>>{};
+      auto rendezvous = std::make_shared<latch>(11);
+      for (int i = 0; i < 10; i++) {
+        workers.emplace_back(make_counted<testee>(rendezvous));
+        workers.back()->ref();
+        sys->scheduler().schedule(workers.back().get(),
+                                  resumable::default_event_id);
+      }
+      THEN("expect the resumables to be executed until done") {
+        rendezvous->count_down_and_wait();
+        for (const auto& worker : workers)
+          check_eq(worker->runs, 10u);
+      }
+    }
+  }
+  EXAMPLES = R"(
+    |    sched           |
+    | stealing           |
+    | lock-free-stealing |
+  )";
+}
+
+namespace {
+
+// Wakes up its buddy on each run until both together ran `limit` times.
+struct relay : resumable, ref_counted {
+  relay(std::shared_ptr<latch> latch_handle, std::atomic<size_t>* total,
+        size_t limit)
+    : rendezvous(std::move(latch_handle)), total(total), limit(limit) {
+  }
+
+  void resume(scheduler* ctx, uint64_t event_id) override {
+    if (event_id == resumable::dispose_event_id)
+      return;
+    ++runs;
+    if (total->fetch_add(1) + 1 == limit) {
+      rendezvous->count_down();
+      return;
+    }
+    buddy->ref();
+    ctx->delay(buddy, resumable::default_event_id);
+  }
+
+  void ref_resumable() const noexcept final {
+    ref();
+  }
+
+  void deref_resumable() const noexcept final {
+    deref();
+  }
+
+  std::atomic<size_t> runs = 0;
+  std::shared_ptr<latch> rendezvous;
+  std::atomic<size_t>* total;
+  size_t limit;
+  relay* buddy = nullptr;
+};
+
+} // namespace
+
+OUTLINE("resumables waking up each other") {
+  GIVEN("a <sched> scheduler with max-lifo-polls set to <polls>") {
+    auto [sched, polls] = block_parameters<std::string, size_t>();
+    actor_system_config cfg;
+    cfg.set("caf.scheduler.policy", sched);
+    cfg.set("caf.scheduler.max-threads", 2);
+    cfg.set("caf.work-stealing.max-lifo-polls", polls);
+    auto sys = std::make_unique<actor_system>(cfg);
+    WHEN("two resumables keep waking up each other") {
+      auto total = std::atomic<size_t>{0};
+      auto rendezvous = std::make_shared<latch>(2);
+      auto ping = make_counted<relay>(rendezvous, &total, 1000);
+      auto pong = make_counted<relay>(rendezvous, &total, 1000);
+      ping->buddy = pong.get();
+      pong->buddy = ping.get();
+      ping->ref();
+      sys->scheduler().schedule(ping.get(), resumable::default_event_id);
+      THEN("both resumables run alternately until reaching the limit") {
+        rendezvous->count_down_and_wait();
+        check_eq(ping->runs.load(), 500u);
+        check_eq(pong->runs.load(), 500u);
+      }
+      sys = nullptr;
+    }
+  }
+  EXAMPLES = R"(
+    |    sched           | polls |
+    | stealing           |     0 |
+    | stealing           |     3 |
+    | lock-free-stealing |     0 |
+    | lock-free-stealing |     3 |
+  )";
+}
+
+OUTLINE("parking idle workers") {
+  GIVEN("a <sched> scheduler with the idle strategy <strategy>") {
+    auto [sched, strategy] = block_parameters<std::string, std::string>();
+    actor_system_config cfg;
+    cfg.set("caf.scheduler.policy", sched);
+    cfg.set("caf.scheduler.max-threads", 2);
+    cfg.set("caf.work-stealing.idle-strategy", strategy);
+    auto sys = std::make_unique<actor_system>(cfg);
+    WHEN("scheduling a resumable after all workers went idle") {
+      std::this_thread::sleep_for(100ms);
+      auto rendezvous = std::make_shared<latch>(2);
+      auto worker = make_counted<testee>(rendezvous);
+      worker->ref();
+      sys->scheduler().schedule(worker.get(), resumable::default_event_id);
+      THEN("a parked worker wakes up and runs the resumable") {
+        rendezvous->count_down_and_wait();
+        check_eq(worker->runs.load(), 10u);
+        auto* wakeups = sys->metrics().counter_singleton(
+          "caf.scheduler", "worker-wakeups",
+          "Number of times a parked worker woke up.");
+        check_ge(wakeups->value(), 1);
+      }
+      sys = nullptr;
+    }
+  }
+  EXAMPLES = R"(
+    |    sched           | strategy |
+    | stealing           | adaptive |
+    | lock-free-stealing | polling  |
   )";
 }
@@ -927,6 +927,88 @@ SCENARIO("binary serializer and deserializer handle vectors of booleans") {
   }
 }
 
+SCENARIO("binary inspectors process arithmetic lists in bulk") {
+  // Produces the same output as the binary serializer before adding the bulk
+  // path, i.e., serializes each value individually.
+  auto element_wise = [](const auto& xs) {
+    byte_buffer buf;
+    binary_serializer sink{buf};
+    sink.begin_sequence(xs.size());
+    for (auto x : xs)
+      sink.value(x);
+    sink.end_sequence();
+    return buf;
+  };
+  GIVEN("a vector of integers") {
+    auto val = std::vector<int32_t>{};
+    for (int32_t i = -500; i < 500; ++i)
+      val.push_back(i * 65'537);
+    WHEN("serializing the vector") {
+      byte_buffer buf;
+      binary_serializer sink{buf};
+      check(sink.apply(val));
+      THEN("the output is identical to serializing each value individually") {
+        check_eq(buf, element_wise(val));
+      }
+      AND_THEN("deserializing the result produces the value again") {
+        auto copy = std::vector<int32_t>{1, 2, 3};
+        binary_deserializer source{buf};
+        check(source.apply(copy));
+        check_eq(copy, val);
+        check_eq(source.remaining(), 0u);
+      }
+    }
+  }
+  GIVEN("a vector of doubles with special values") {
+    using limits = std::numeric_limits<double>;
+    auto val = std::vector<double>{0.0,
+                                   -0.0,
+                                   1.5,
+                                   -2.25e100,
+                                   limits::min(),
+                                   limits::max(),
+                                   limits::denorm_min(),
+                                   limits::infinity(),
+                                   -limits::infinity(),
+                                   limits::quiet_NaN()};
+    WHEN("serializing the vector") {
+      byte_buffer buf;
+      binary_serializer sink{buf};
+      check(sink.apply(val));
+      THEN("the output is identical to serializing each value individually") {
+        check_eq(buf, element_wise(val));
+      }
+      AND_THEN("deserializing the result produces the value again") {
+        auto copy = std::vector<double>{};
+        binary_deserializer source{buf};
+        check(source.apply(copy));
+        require_eq(copy.size(), val.size());
+        // Note: the portable encoding does not preserve subnormal numbers.
+        for (size_t i = 0; i + 1 < val.size(); ++i)
+          if (std::fpclassify(val[i]) != FP_SUBNORMAL)
+            check(copy[i] == val[i]);
+        check(std::signbit(copy[1]));
+        check(std::isnan(copy.back()));
+      }
+    }
+  }
+  GIVEN("a truncated input") {
+    auto val = std::vector<uint64_t>(100, 0xDEADBEEF);
+    byte_buffer buf;
+    binary_serializer sink{buf};
+    check(sink.apply(val));
+    buf.pop_back();
+    WHEN("deserializing the vector") {
+      THEN("the deserializer reports an end-of-stream error") {
+        auto copy = std::vector<uint64_t>{};
+        binary_deserializer source{buf};
+        check(!source.apply(copy));
+        check_eq(source.get_error(), sec::end_of_stream);
+      }
+    }
+  }
+}
+
 } // WITH_FIXTURE(fixture)
 
 TEST_INIT() {
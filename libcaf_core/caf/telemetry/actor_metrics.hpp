@@ -5,13 +5,89 @@
 #pragma once
 
 #include "caf/fwd.hpp"
+#include "caf/telemetry/counter.hpp"
+#include "caf/telemetry/gauge.hpp"
+#include "caf/telemetry/sharded_counter.hpp"
+#include "caf/telemetry/sharded_gauge.hpp"
 
 namespace caf::telemetry {
 
+/// Points to either a regular or a sharded metric (or to nothing). Allows
+/// actors to update their metrics without knowing whether the user enabled
+/// `caf.metrics.shard-actor-metrics`.
+template <class Plain, class Sharded>
+class actor_metric_ptr {
+public:
+  using value_type = typename Plain::value_type;
+
+  actor_metric_ptr() noexcept = default;
+
+  actor_metric_ptr(Plain* ptr) noexcept : plain_(ptr) {
+    // nop
+  }
+
+  actor_metric_ptr(Sharded* ptr) noexcept : sharded_(ptr) {
+    // nop
+  }
+
+  explicit operator bool() const noexcept {
+    return plain_ != nullptr || sharded_ != nullptr;
+  }
+
+  Plain* plain() const noexcept {
+    return plain_;
+  }
+
+  Sharded* sharded() const noexcept {
+    return sharded_;
+  }
+
+  /// @pre `static_cast<bool>(*this)`
+  void inc() noexcept {
+    if (plain_)
+      plain_->inc();
+    else
+      sharded_->inc();
+  }
+
+  /// @pre `static_cast<bool>(*this)`
+  void inc(value_type amount) noexcept {
+    if (plain_)
+      plain_->inc(amount);
+    else
+      sharded_->inc(amount);
+  }
+
+  /// @pre `static_cast<bool>(*this)`
+  void dec() noexcept {
+    if (plain_)
+      plain_->dec();
+    else
+      sharded_->dec();
+  }
+
+  /// @pre `static_cast<bool>(*this)`
+  void dec(value_type amount) noexcept {
+    if (plain_)
+      plain_->dec(amount);
+    else
+      sharded_->dec(amount);
+  }
+
+  /// @pre `static_cast<bool>(*this)`
+  value_type value() const noexcept {
+    return plain_ ? plain_->value() : sharded_->value();
+  }
+
+private:
+  Plain* plain_ = nullptr;
+  Sharded* sharded_ = nullptr;
+};
+
 /// Optional metrics collected by individual actors when configured to do so.
 struct actor_metrics {
   /// Counts the total number of processed messages.
-  int_counter* processed_messages = nullptr;
+  actor_metric_ptr<int_counter, sharded_int_counter> processed_messages;
 
   /// Samples how long the actor needs to process messages.
   dbl_histogram* processing_time = nullptr;
@@ -20,7 +96,10 @@ struct actor_metrics {
   dbl_histogram* mailbox_time = nullptr;
 
   /// Counts how many messages are currently waiting in the mailbox.
-  int_gauge* mailbox_size = nullptr;
+  actor_metric_ptr<int_gauge, sharded_int_gauge> mailbox_size;
+
+  /// Counts how many requests are currently waiting for a response.
+  int_gauge* pending_requests = nullptr;
 
   /// Tracks the current number of running actors of this type.
   int_gauge* running_count = nullptr;
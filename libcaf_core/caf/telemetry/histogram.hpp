@@ -13,6 +13,7 @@
 #include "caf/telemetry/metric_type.hpp"
 
 #include <algorithm>
+#include <array>
 #include <span>
 #include <type_traits>
 
@@ -35,6 +36,73 @@ public:
     int_counter count;
   };
 
+  /// Accumulates observations locally and adds them to the histogram in one
+  /// step. This reduces the number of atomic operations when a thread observes
+  /// many values in a row, e.g., while an actor processes a batch of messages.
+  /// The batch adds its observations to the histogram when calling `flush`,
+  /// after `flush_threshold` observations and when going out of scope.
+  /// Histograms with more than `max_buckets` buckets bypass the batch.
+  /// @note A batch is not thread-safe and must not outlive its histogram.
+  class batch {
+  public:
+    /// Maximum number of buckets for which the batch buffers observations.
+    static constexpr size_t max_buckets = 16;
+
+    /// Number of observations after which the batch flushes automatically.
+    static constexpr size_t flush_threshold = 128;
+
+    explicit batch(histogram* parent) noexcept : parent_(parent) {
+      // nop
+    }
+
+    batch(const batch&) = delete;
+
+    batch& operator=(const batch&) = delete;
+
+    ~batch() {
+      flush();
+    }
+
+    /// Returns the histogram for this batch.
+    histogram* parent() const noexcept {
+      return parent_;
+    }
+
+    /// Buffers an observation for the histogram.
+    /// @pre `parent() != nullptr`
+    void observe(value_type value) noexcept {
+      if (parent_->num_buckets_ > max_buckets) {
+        parent_->observe(value);
+        return;
+      }
+      ++counts_[parent_->bucket_index(value)];
+      sum_ += value;
+      if (++pending_ == flush_threshold)
+        flush();
+    }
+
+    /// Adds all buffered observations to the histogram.
+    void flush() noexcept {
+      if (pending_ == 0)
+        return;
+      for (size_t index = 0; index < parent_->num_buckets_; ++index) {
+        if (auto& count = counts_[index]; count > 0) {
+          parent_->buckets_[index].count.inc(count);
+          count = 0;
+        }
+      }
+      parent_->sum_.inc(sum_);
+      sum_ = 0;
+      pending_ = 0;
+    }
+
+  private:
+    histogram* parent_;
+    size_t pending_ = 0;
+    value_type sum_ = 0;
+    std::array<int64_t, max_buckets> counts_ = {};
+  };
+
   // -- constants --------------------------------------------------------------
 
   static constexpr metric_type runtime_type = std::is_same_v<value_type, double>
@@ -68,16 +136,8 @@ public:
   /// Increments the bucket where the observed value falls into and increments
   /// the sum of all observed values.
   void observe(value_type value) {
-    // The last bucket has an upper bound of +inf or int_max, so we'll always
-    // find a bucket and increment the counters.
-    for (size_t index = 0;; ++index) {
-      auto& [upper_bound, count] = buckets_[index];
-      if (value <= upper_bound) {
-        count.inc();
-        sum_.inc(value);
-        return;
-      }
-    }
+    buckets_[bucket_index(value)].count.inc();
+    sum_.inc(value);
   }
 
   // -- observers --------------------------------------------------------------
@@ -93,6 +153,22 @@ public:
   }
 
 private:
+  /// Returns the index of the first bucket with an upper bound that is greater
+  /// than or equal to `value`. Uses a binary search without branches in the
+  /// loop body, since the outcome of each comparison is hard to predict.
+  size_t bucket_index(value_type value) const noexcept {
+    // The last bucket has an upper bound of +inf or int_max, so we'll always
+    // find a bucket.
+    const bucket_type* first = buckets_;
+    auto len = num_buckets_;
+    while (len > 1) {
+      auto half = len / 2;
+      first += first[half - 1].upper_bound < value ? half : 0;
+      len -= half;
+    }
+    return static_cast<size_t>(first - buckets_);
+  }
+
   void init_buckets(std::span<const value_type> upper_bounds) {
     CAF_ASSERT(std::is_sorted(upper_bounds.begin(), upper_bounds.end()));
     using limits = std::numeric_limits<value_type>;
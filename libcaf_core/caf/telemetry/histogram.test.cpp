@@ -44,3 +44,52 @@ TEST("histograms aggregate to buckets and keep a sum") {
   check_eq(buckets[3].count.value(), 2); // 9, 10
   check_eq(h1.sum(), 55);
 }
+
+TEST("histograms find the bucket for values on and between bounds") {
+  dbl_histogram h1{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+  for (auto value : {0.5, 1.0, 1.5, 6.0, 11.5, 12.0, 100.0})
+    h1.observe(value);
+  auto buckets = h1.buckets();
+  require_eq(buckets.size(), 13u);
+  auto count = [&buckets](size_t index) {
+    return buckets[index].count.value();
+  };
+  check_eq(count(0), 2);  // 0.5, 1.0
+  check_eq(count(1), 1);  // 1.5
+  check_eq(count(5), 1);  // 6.0
+  check_eq(count(11), 2); // 11.5, 12.0
+  check_eq(count(12), 1); // 100.0
+  check_eq(h1.sum(), test::approx{132.5});
+}
+
+TEST("histogram batches add their observations when flushing") {
+  int_histogram h1{2, 4, 8};
+  SECTION("flushing explicitly") {
+    int_histogram::batch batch{&h1};
+    for (int64_t value = 1; value < 11; ++value)
+      batch.observe(value);
+    check_eq(h1.sum(), 0);
+    batch.flush();
+    auto buckets = h1.buckets();
+    check_eq(buckets[0].count.value(), 2);
+    check_eq(buckets[1].count.value(), 2);
+    check_eq(buckets[2].count.value(), 4);
+    check_eq(buckets[3].count.value(), 2);
+    check_eq(h1.sum(), 55);
+  }
+  SECTION("flushing on destruction") {
+    {
+      int_histogram::batch batch{&h1};
+      batch.observe(3);
+    }
+    check_eq(h1.buckets()[1].count.value(), 1);
+    check_eq(h1.sum(), 3);
+  }
+  SECTION("flushing after reaching the threshold") {
+    int_histogram::batch batch{&h1};
+    for (size_t i = 0; i < int_histogram::batch::flush_threshold; ++i)
+      batch.observe(1);
+    check_eq(h1.buckets()[0].count.value(), 128);
+    check_eq(h1.sum(), 128);
+  }
+}
@@ -15,6 +15,7 @@
 #include <memory>
 #include <mutex>
 #include <span>
+#include <type_traits>
 
 namespace caf::telemetry {
 
@@ -91,11 +92,25 @@ public:
   template <class Collector>
   void collect(Collector& collector) const {
     std::unique_lock<std::mutex> guard{mx_};
-    for (auto& ptr : metrics_)
-      collector(this, ptr.get(), std::addressof(ptr->impl()));
+    if constexpr (passes_snapshot<Collector>) {
+      // The collector only knows the regular metric types.
+      for (auto& ptr : metrics_) {
+        typename Type::snapshot_type snapshot{ptr->impl().value()};
+        collector(this, ptr.get(), std::addressof(snapshot));
+      }
+    } else {
+      for (auto& ptr : metrics_)
+        collector(this, ptr.get(), std::addressof(ptr->impl()));
+    }
   }
 
 private:
+  template <class Collector>
+  static constexpr bool passes_snapshot
+    = requires { typename Type::snapshot_type; }
+      && !std::is_invocable_v<Collector&, const metric_family*, const metric*,
+                              const Type*>;
+
   const settings* config_;
   extra_setting_type extra_setting_;
   mutable std::mutex mx_;
@@ -217,14 +217,16 @@ bool metric_registry::wait_for_impl(std::string_view prefix,
   };
   using collect_result
     = std::variant<std::monostate, const int_counter*, const dbl_counter*,
-                   const int_gauge*, const dbl_gauge*>;
+                   const int_gauge*, const dbl_gauge*,
+                   const sharded_int_counter*, const sharded_int_gauge*>;
   collect_result result;
   auto collector = [prefix, name, labels,
                     &result]<class Wrapped>(const metric_family* family,
                                             const metric* instance,
                                             const Wrapped* wrapped) {
     if constexpr (detail::one_of<Wrapped, int_counter, dbl_counter, int_gauge,
-                                 dbl_gauge>) {
+                                 dbl_gauge, sharded_int_counter,
+                                 sharded_int_gauge>) {
       if (family->prefix() == prefix && family->name() == name
           && labels_match(labels, instance->labels())) {
         result = wrapped;
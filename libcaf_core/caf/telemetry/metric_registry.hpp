@@ -14,6 +14,8 @@
 #include "caf/telemetry/gauge.hpp"
 #include "caf/telemetry/histogram.hpp"
 #include "caf/telemetry/metric_family_impl.hpp"
+#include "caf/telemetry/sharded_counter.hpp"
+#include "caf/telemetry/sharded_gauge.hpp"
 #include "caf/timespan.hpp"
 
 #include <algorithm>
@@ -296,6 +298,84 @@ public:
     return fptr->get_or_add({});
   }
 
+  /// Returns a sharded counter metric family. Sharded counters reduce
+  /// contention on counters that many threads increment concurrently at the
+  /// cost of slower reads. Collectors see them as regular counters. Creates the
+  /// family lazily if necessary, but fails if the full name already belongs to
+  /// a different family.
+  /// @copydetails counter_family
+  template <class ValueType = int64_t>
+  metric_family_impl<sharded_counter<ValueType>>*
+  sharded_counter_family(std::string_view prefix, std::string_view name,
+                         span_t<std::string_view> labels,
+                         std::string_view helptext, std::string_view unit = "1",
+                         bool is_sum = true) {
+    using counter_type = sharded_counter<ValueType>;
+    using family_type = metric_family_impl<counter_type>;
+    std::unique_lock<std::mutex> guard{families_mx_};
+    if (auto ptr = fetch(prefix, name)) {
+      assert_properties(ptr, counter_type::runtime_type, labels, unit, is_sum);
+      return static_cast<family_type*>(ptr);
+    }
+    auto ptr = std::make_unique<family_type>(
+      std::string{prefix}, std::string{name}, to_sorted_vec(labels),
+      std::string{helptext}, std::string{unit}, is_sum);
+    auto result = ptr.get();
+    families_.emplace_back(std::move(ptr));
+    return result;
+  }
+
+  /// @copydoc sharded_counter_family
+  template <class ValueType = int64_t>
+  metric_family_impl<sharded_counter<ValueType>>*
+  sharded_counter_family(std::string_view prefix, std::string_view name,
+                         std::initializer_list<std::string_view> labels,
+                         std::string_view helptext, std::string_view unit = "1",
+                         bool is_sum = true) {
+    auto lbl_span = std::span{labels.begin(), labels.size()};
+    return sharded_counter_family<ValueType>(prefix, name, lbl_span, helptext,
+                                             unit, is_sum);
+  }
+
+  /// Returns a sharded gauge metric family. Sharded gauges reduce contention
+  /// on gauges that many threads update concurrently at the cost of slower
+  /// reads. Collectors see them as regular gauges. Creates the family lazily if
+  /// necessary, but fails if the full name already belongs to a different
+  /// family.
+  /// @copydetails gauge_family
+  template <class ValueType = int64_t>
+  metric_family_impl<sharded_gauge<ValueType>>*
+  sharded_gauge_family(std::string_view prefix, std::string_view name,
+                       span_t<std::string_view> labels,
+                       std::string_view helptext, std::string_view unit = "1",
+                       bool is_sum = false) {
+    using gauge_type = sharded_gauge<ValueType>;
+    using family_type = metric_family_impl<gauge_type>;
+    std::unique_lock<std::mutex> guard{families_mx_};
+    if (auto ptr = fetch(prefix, name)) {
+      assert_properties(ptr, gauge_type::runtime_type, labels, unit, is_sum);
+      return static_cast<family_type*>(ptr);
+    }
+    auto ptr = std::make_unique<family_type>(
+      std::string{prefix}, std::string{name}, to_sorted_vec(labels),
+      std::string{helptext}, std::string{unit}, is_sum);
+    auto result = ptr.get();
+    families_.emplace_back(std::move(ptr));
+    return result;
+  }
+
+  /// @copydoc sharded_gauge_family
+  template <class ValueType = int64_t>
+  metric_family_impl<sharded_gauge<ValueType>>*
+  sharded_gauge_family(std::string_view prefix, std::string_view name,
+                       std::initializer_list<std::string_view> labels,
+                       std::string_view helptext, std::string_view unit = "1",
+                       bool is_sum = false) {
+    auto lbl_span = std::span{labels.begin(), labels.size()};
+    return sharded_gauge_family<ValueType>(prefix, name, lbl_span, helptext,
+                                           unit, is_sum);
+  }
+
   /// Returns a histogram metric family. Creates the family lazily if
   /// necessary, but fails if the full name already belongs to a different
   /// family.
@@ -603,6 +683,12 @@ private:
         return f(static_cast<const metric_family_impl<int_gauge>*>(ptr));
       case metric_type::dbl_histogram:
         return f(static_cast<const metric_family_impl<dbl_histogram>*>(ptr));
+      case metric_type::sharded_int_counter:
+        return f(
+          static_cast<const metric_family_impl<sharded_int_counter>*>(ptr));
+      case metric_type::sharded_int_gauge:
+        return f(
+          static_cast<const metric_family_impl<sharded_int_gauge>*>(ptr));
       default:
         CAF_ASSERT(ptr->type() == metric_type::int_histogram);
         return f(static_cast<const metric_family_impl<int_histogram>*>(ptr));
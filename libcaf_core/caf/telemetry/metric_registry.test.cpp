@@ -545,4 +545,6 @@ TEST("enabling actor metrics per config creates metric instances") {
   sys.metrics().collect(collector);
   check_ne(collector.result.find(R"(caf.actor.mailbox-size{name="foo"})"),
            std::string::npos);
+  check_ne(collector.result.find(R"(caf.actor.pending-requests{name="foo"} 0)"),
+           std::string::npos);
 }
@@ -15,6 +15,8 @@ enum class metric_type : uint8_t {
   int_gauge,
   dbl_histogram,
   int_histogram,
+  sharded_int_counter,
+  sharded_int_gauge,
 };
 
 } // namespace caf::telemetry
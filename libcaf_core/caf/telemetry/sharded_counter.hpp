@@ -0,0 +1,84 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/detail/assert.hpp"
+#include "caf/fwd.hpp"
+#include "caf/telemetry/counter.hpp"
+#include "caf/telemetry/label.hpp"
+#include "caf/telemetry/metric_type.hpp"
+#include "caf/telemetry/sharded_gauge.hpp"
+
+#include <span>
+
+namespace caf::telemetry {
+
+/// A counter that spreads updates over multiple shards to avoid contention
+/// when many threads increment the same counter. See `sharded_gauge` for
+/// details.
+/// @note Collectors that have no dedicated overload for this type receive an
+///       `int_counter` that holds a snapshot of the current value.
+template <class ValueType>
+class sharded_counter {
+public:
+  // -- member types -----------------------------------------------------------
+
+  using value_type = ValueType;
+
+  using family_setting = unit_t;
+
+  /// The metric type for passing the current value to collectors.
+  using snapshot_type = counter<value_type>;
+
+  // -- constants --------------------------------------------------------------
+
+  static constexpr metric_type runtime_type = metric_type::sharded_int_counter;
+
+  // -- constructors, destructors, and assignment operators --------------------
+
+  sharded_counter() = default;
+
+  explicit sharded_counter(value_type initial_value) : gauge_(initial_value) {
+    // nop
+  }
+
+  explicit sharded_counter(std::span<const label>) {
+    // nop
+  }
+
+  // -- modifiers --------------------------------------------------------------
+
+  /// Increments the counter by 1.
+  void inc() noexcept {
+    gauge_.inc();
+  }
+
+  /// Increments the counter by `amount`.
+  /// @pre `amount >= 0`
+  void inc(value_type amount) noexcept {
+    CAF_ASSERT(amount >= 0);
+    gauge_.inc(amount);
+  }
+
+  // -- observers --------------------------------------------------------------
+
+  /// Returns the current value of the counter, i.e., the sum of all shards.
+  value_type value() const noexcept {
+    return gauge_.value();
+  }
+
+  /// Returns the number of shards.
+  size_t num_shards() const noexcept {
+    return gauge_.num_shards();
+  }
+
+private:
+  sharded_gauge<value_type> gauge_;
+};
+
+/// Convenience alias for a sharded counter with value type `int64_t`.
+using sharded_int_counter = sharded_counter<int64_t>;
+
+} // namespace caf::telemetry
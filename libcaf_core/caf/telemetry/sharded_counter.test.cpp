@@ -0,0 +1,98 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/telemetry/sharded_counter.hpp"
+
+#include "caf/test/test.hpp"
+
+#include "caf/telemetry/collector/prometheus.hpp"
+#include "caf/telemetry/metric_registry.hpp"
+#include "caf/telemetry/sharded_gauge.hpp"
+
+#include <thread>
+#include <vector>
+
+using namespace caf;
+using namespace caf::telemetry;
+
+using namespace std::literals;
+
+TEST("sharded counters and gauges aggregate all shards on read") {
+  SECTION("counters start at 0 and are incrementable") {
+    sharded_int_counter c;
+    check_eq(c.value(), 0);
+    c.inc();
+    c.inc(2);
+    check_eq(c.value(), 3);
+    check_eq(sharded_int_counter{42}.value(), 42);
+  }
+  SECTION("gauges start at 0 and go up and down") {
+    sharded_int_gauge g;
+    check_eq(g.value(), 0);
+    g.inc();
+    g.inc(4);
+    g.dec();
+    g.dec(2);
+    check_eq(g.value(), 2);
+    g.value(42);
+    check_eq(g.value(), 42);
+  }
+  SECTION("the number of shards is a power of two") {
+    sharded_int_gauge g;
+    auto n = g.num_shards();
+    check_ge(n, 1u);
+    check_le(n, detail::max_thread_shards);
+    check_eq(n & (n - 1), 0u);
+  }
+}
+
+TEST("sharded counters sum up increments from all threads") {
+  sharded_int_counter c;
+  sharded_int_gauge g;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&c, &g] {
+      for (int j = 0; j < 1000; ++j) {
+        c.inc();
+        g.inc(2);
+        g.dec();
+      }
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+  check_eq(c.value(), 4000);
+  check_eq(g.value(), 4000);
+}
+
+TEST("the Prometheus collector renders sharded metrics as regular ones") {
+  metric_registry registry;
+  auto* sc = registry.sharded_counter_family("foo", "hits", {"x"}, "Hits.")
+               ->get_or_add({{"x", "1"}});
+  auto* sg = registry.sharded_gauge_family("foo", "size", {"x"}, "Size.")
+               ->get_or_add({{"x", "1"}});
+  sc->inc(7);
+  sg->inc(3);
+  collector::prometheus exporter;
+  check_eq(exporter.collect_from(registry, timestamp{42s}),
+           R"(# HELP foo_hits_total Hits.
+# TYPE foo_hits_total counter
+foo_hits_total{x="1"} 7 42000
+# HELP foo_size Size.
+# TYPE foo_size gauge
+foo_size{x="1"} 3 42000
+)"sv);
+  check(registry.wait_for("foo", "hits", {{"x", "1"}}, 1s, 1ms,
+                          [](int64_t x) { return x == 7; }));
+}
+
+#ifdef CAF_ENABLE_EXCEPTIONS
+TEST("sharded and regular metrics may not share a name") {
+  metric_registry registry;
+  registry.sharded_counter_family("foo", "hits", {"x"}, "Hits.");
+  check_throws([&registry] {
+    registry.counter_family("foo", "hits", {"x"}, "Hits.");
+  });
+}
+#endif
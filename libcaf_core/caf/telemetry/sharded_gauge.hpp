@@ -0,0 +1,122 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/config.hpp"
+#include "caf/detail/thread_shard.hpp"
+#include "caf/fwd.hpp"
+#include "caf/telemetry/gauge.hpp"
+#include "caf/telemetry/label.hpp"
+#include "caf/telemetry/metric_type.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+namespace caf::telemetry {
+
+/// A gauge that spreads updates over multiple shards, each on its own cache
+/// line, to avoid contention when many threads update the same gauge. Each
+/// thread updates its own shard and reading the value adds up all shards.
+/// Hence, writes are cheap but reads are more expensive than for a `gauge`.
+/// @note Collectors that have no dedicated overload for this type receive an
+///       `int_gauge` that holds a snapshot of the current value.
+template <class ValueType>
+class sharded_gauge {
+public:
+  // -- member types -----------------------------------------------------------
+
+  using value_type = ValueType;
+
+  using family_setting = unit_t;
+
+  /// The metric type for passing the current value to collectors.
+  using snapshot_type = gauge<value_type>;
+
+  static_assert(std::is_same_v<value_type, int64_t>,
+                "sharded gauges only support int64_t");
+
+  // -- constants --------------------------------------------------------------
+
+  static constexpr metric_type runtime_type = metric_type::sharded_int_gauge;
+
+  // -- constructors, destructors, and assignment operators --------------------
+
+  sharded_gauge() : mask_(detail::default_thread_shards() - 1) {
+    shards_ = std::make_unique<shard[]>(mask_ + 1);
+  }
+
+  explicit sharded_gauge(value_type value) : sharded_gauge() {
+    shards_[0].value.store(value, std::memory_order_relaxed);
+  }
+
+  explicit sharded_gauge(std::span<const label>) : sharded_gauge() {
+    // nop
+  }
+
+  // -- modifiers --------------------------------------------------------------
+
+  /// Increments the gauge by 1.
+  void inc() noexcept {
+    local().fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /// Increments the gauge by `amount`.
+  void inc(value_type amount) noexcept {
+    local().fetch_add(amount, std::memory_order_relaxed);
+  }
+
+  /// Decrements the gauge by 1.
+  void dec() noexcept {
+    local().fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  /// Decrements the gauge by `amount`.
+  void dec(value_type amount) noexcept {
+    local().fetch_sub(amount, std::memory_order_relaxed);
+  }
+
+  /// Sets the gauge to `x`.
+  /// @warning Concurrent updates from other threads may get lost.
+  void value(value_type x) noexcept {
+    shards_[0].value.store(x, std::memory_order_relaxed);
+    for (size_t index = 1; index <= mask_; ++index)
+      shards_[index].value.store(0, std::memory_order_relaxed);
+  }
+
+  // -- observers --------------------------------------------------------------
+
+  /// Returns the current value of the gauge, i.e., the sum of all shards.
+  value_type value() const noexcept {
+    value_type result = 0;
+    for (size_t index = 0; index <= mask_; ++index)
+      result += shards_[index].value.load(std::memory_order_relaxed);
+    return result;
+  }
+
+  /// Returns the number of shards.
+  size_t num_shards() const noexcept {
+    return mask_ + 1;
+  }
+
+private:
+  struct alignas(CAF_CACHE_LINE_SIZE) shard {
+    std::atomic<value_type> value = 0;
+  };
+
+  std::atomic<value_type>& local() noexcept {
+    return shards_[detail::this_thread_shard() & mask_].value;
+  }
+
+  size_t mask_;
+  std::unique_ptr<shard[]> shards_;
+};
+
+/// Convenience alias for a sharded gauge with value type `int64_t`.
+using sharded_int_gauge = sharded_gauge<int64_t>;
+
+} // namespace caf::telemetry
@@ -41,6 +41,12 @@ public:
     h->observe(std::chrono::duration_cast<dbl_sec>(end - start).count());
   }
 
+  static void observe(dbl_histogram::batch& h, clock_type::time_point start) {
+    using dbl_sec = std::chrono::duration<double>;
+    auto end = clock_type::now();
+    h.observe(std::chrono::duration_cast<dbl_sec>(end - start).count());
+  }
+
 private:
   dbl_histogram* h_;
   clock_type::time_point start_;
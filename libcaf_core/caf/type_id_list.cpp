@@ -5,16 +5,20 @@
 #include "caf/type_id_list.hpp"
 
 #include "caf/detail/meta_object.hpp"
+#include "caf/detail/offset_table.hpp"
 #include "caf/detail/type_id_list_builder.hpp"
 #include "caf/message.hpp"
 
 namespace caf {
 
 size_t type_id_list::data_size() const noexcept {
-  auto result = size_t{0};
-  for (auto type : *this)
-    result += detail::global_meta_object(type).padded_size;
-  return result;
+  if (empty())
+    return 0;
+  return offsets()[size()];
+}
+
+const size_t* type_id_list::offsets() const noexcept {
+  return detail::offset_table(*this);
 }
 
 std::string to_string(type_id_list xs) {
@@ -81,6 +81,13 @@ public:
   /// type-erased tuple for the element types stored in this list.
   size_t data_size() const noexcept;
 
+  /// Returns the byte offsets of the elements in a type-erased tuple for the
+  /// element types stored in this list, followed by the value of
+  /// `data_size()`. CAF computes the offsets only once per list.
+  /// @pre the list was created with `make_type_id_list` or by a
+  ///      `type_id_list_builder`.
+  const size_t* offsets() const noexcept;
+
   /// Concatenates all `lists` into a single type ID list.
   static type_id_list concat(std::span<type_id_list> lists);
 
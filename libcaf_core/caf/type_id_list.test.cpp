@@ -6,6 +6,7 @@
 
 #include "caf/test/test.hpp"
 
+#include "caf/detail/offset_at.hpp"
 #include "caf/init_global_meta_objects.hpp"
 
 namespace detail {
@@ -114,3 +115,32 @@ TEST("type ID lists are concatenable") {
            type_id_list::concat(make_type_id_list<int8_t, int16_t>(),
                                 make_type_id_list<int32_t, int64_t>()));
 }
+
+TEST("type ID lists provide the offsets of type-erased tuple elements") {
+  using caf::detail::offset_at;
+  auto check_offsets = [this](type_id_list xs) {
+    auto offsets = xs.offsets();
+    check_eq(offsets, xs.offsets());
+    check_eq(offsets[0], 0u);
+    check_eq(offsets[1], (offset_at<1, int8_t, std::string, int64_t>));
+    check_eq(offsets[2], (offset_at<2, int8_t, std::string, int64_t>));
+    check_eq(offsets[3], xs.data_size());
+    check_eq(xs.data_size(), offsets[2] + caf::detail::padded_size_v<int64_t>);
+  };
+  SECTION("lists from make_type_id_list") {
+    check_offsets(make_type_id_list<int8_t, std::string, int64_t>());
+  }
+  SECTION("lists from concat") {
+    check_offsets(type_id_list::concat(make_type_id_list<int8_t>(),
+                                       make_type_id_list<std::string>(),
+                                       make_type_id_list<int64_t>()));
+  }
+}
+
+TEST("compile-time offset tables match the offsets of type ID lists") {
+  using caf::detail::offset_table_v;
+  auto& expected = offset_table_v<int8_t, std::string, int64_t>;
+  auto offsets = make_type_id_list<int8_t, std::string, int64_t>().offsets();
+  for (size_t index = 0; index < expected.size(); ++index)
+    check_eq(offsets[index], expected[index]);
+}
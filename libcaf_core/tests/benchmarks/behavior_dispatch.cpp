@@ -0,0 +1,146 @@
+// Measures how long it takes a behavior to dispatch a message to its last
+// handler, depending on the number of handlers in the behavior. Behaviors with
+// at least detail::behavior_dispatch_index::min_handlers handlers look up the
+// handler in a dispatch index, smaller behaviors try each handler in turn.
+
+#include "harness.hpp"
+
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/behavior.hpp"
+#include "caf/caf_main.hpp"
+#include "caf/detail/type_list.hpp"
+#include "caf/message.hpp"
+#include "caf/type_id.hpp"
+
+#include <cstdint>
+#include <utility>
+
+CAF_BEGIN_TYPE_ID_BLOCK(behavior_dispatch_benchmark, caf::first_custom_type_id)
+
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a00_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a01_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a02_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a03_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a04_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a05_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a06_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a07_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a08_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a09_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a10_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a11_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a12_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a13_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a14_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a15_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a16_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a17_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a18_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a19_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a20_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a21_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a22_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a23_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a24_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a25_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a26_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a27_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a28_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a29_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a30_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a31_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a32_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a33_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a34_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a35_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a36_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a37_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a38_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a39_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a40_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a41_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a42_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a43_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a44_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a45_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a46_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a47_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a48_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a49_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a50_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a51_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a52_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a53_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a54_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a55_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a56_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a57_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a58_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a59_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a60_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a61_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a62_atom)
+  CAF_ADD_ATOM(behavior_dispatch_benchmark, a63_atom)
+
+CAF_END_TYPE_ID_BLOCK(behavior_dispatch_benchmark)
+
+using namespace caf;
+using namespace caf::benchmarks;
+
+namespace {
+
+constexpr size_t default_runs = 10'000'000;
+
+using atoms = type_list<
+  a00_atom, a01_atom, a02_atom, a03_atom, a04_atom, a05_atom, a06_atom,
+  a07_atom, a08_atom, a09_atom, a10_atom, a11_atom, a12_atom, a13_atom,
+  a14_atom, a15_atom, a16_atom, a17_atom, a18_atom, a19_atom, a20_atom,
+  a21_atom, a22_atom, a23_atom, a24_atom, a25_atom, a26_atom, a27_atom,
+  a28_atom, a29_atom, a30_atom, a31_atom, a32_atom, a33_atom, a34_atom,
+  a35_atom, a36_atom, a37_atom, a38_atom, a39_atom, a40_atom, a41_atom,
+  a42_atom, a43_atom, a44_atom, a45_atom, a46_atom, a47_atom, a48_atom,
+  a49_atom, a50_atom, a51_atom, a52_atom, a53_atom, a54_atom, a55_atom,
+  a56_atom, a57_atom, a58_atom, a59_atom, a60_atom, a61_atom, a62_atom,
+  a63_atom>;
+
+using config = config_base;
+
+template <size_t I>
+auto make_handler(size_t& hits) {
+  using atom_type = detail::tl_at_t<atoms, I>;
+  return [&hits](atom_type) { ++hits; };
+}
+
+template <size_t... Is>
+behavior make_dispatch_behavior(size_t& hits, std::index_sequence<Is...>) {
+  return behavior{make_handler<Is>(hits)...};
+}
+
+template <size_t N>
+void run(actor_system& sys, size_t runs) {
+  auto hits = size_t{0};
+  auto bhvr = make_dispatch_behavior(hits, std::make_index_sequence<N>{});
+  auto msg = make_message(detail::tl_at_t<atoms, N - 1>{});
+  auto latency = measure_per_item(runs, 1, [&] {
+    return bhvr(msg).has_value();
+  });
+  sys.println("{:>2} handlers: {:.2f} ns per message ({} hits)", N, latency,
+              hits);
+}
+
+} // namespace
+
+int caf_main(actor_system& sys, const config& cfg) {
+  auto runs = get_or(cfg, "runs", default_runs);
+  run<1>(sys, runs);
+  run<4>(sys, runs);
+  run<7>(sys, runs);
+  run<8>(sys, runs);
+  run<16>(sys, runs);
+  run<32>(sys, runs);
+  run<64>(sys, runs);
+  return EXIT_SUCCESS;
+}
+
+CAF_MAIN(id_block::behavior_dispatch_benchmark)
@@ -0,0 +1,105 @@
+// Measures how fast the binary serializer and deserializer process vectors of
+// arithmetic values. Compares the bulk path that `apply` uses for such vectors
+// with inspecting each value individually.
+
+#include "harness.hpp"
+
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/binary_deserializer.hpp"
+#include "caf/binary_serializer.hpp"
+#include "caf/byte_buffer.hpp"
+#include "caf/caf_main.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+using namespace caf;
+using namespace caf::benchmarks;
+
+namespace {
+
+constexpr size_t default_elements = 1'000'000;
+
+constexpr size_t default_runs = 20;
+
+struct config : config_base {
+  config() {
+    opt_group{custom_options_, "global"} //
+      .add<size_t>("elements,n", "number of elements per vector");
+  }
+};
+
+template <class T>
+bool save_element_wise(binary_serializer& sink, const std::vector<T>& xs) {
+  if (!sink.begin_sequence(xs.size()))
+    return false;
+  for (auto x : xs)
+    if (!sink.value(x))
+      return false;
+  return sink.end_sequence();
+}
+
+template <class T>
+bool load_element_wise(binary_deserializer& source, std::vector<T>& xs) {
+  xs.clear();
+  auto size = size_t{0};
+  if (!source.begin_sequence(size))
+    return false;
+  for (size_t i = 0; i < size; ++i) {
+    auto x = T{};
+    if (!source.value(x))
+      return false;
+    xs.push_back(x);
+  }
+  return source.end_sequence();
+}
+
+template <class T>
+void run(actor_system& sys, const char* name, size_t elements, size_t runs) {
+  std::vector<T> xs;
+  xs.reserve(elements);
+  for (size_t i = 0; i < elements; ++i)
+    xs.push_back(static_cast<T>(i) * static_cast<T>(3));
+  auto bytes = elements * sizeof(T);
+  byte_buffer buf;
+  buf.reserve(bytes + 16);
+  auto save_bulk = measure_throughput(runs, bytes, [&] {
+    buf.clear();
+    binary_serializer sink{buf};
+    return sink.apply(xs);
+  });
+  auto save_single = measure_throughput(runs, bytes, [&] {
+    buf.clear();
+    binary_serializer sink{buf};
+    return save_element_wise(sink, xs);
+  });
+  std::vector<T> ys;
+  auto load_bulk = measure_throughput(runs, bytes, [&] {
+    binary_deserializer source{buf};
+    return source.apply(ys);
+  });
+  auto load_single = measure_throughput(runs, bytes, [&] {
+    binary_deserializer source{buf};
+    return load_element_wise(source, ys);
+  });
+  sys.println("{:>8}: save {:>8.1f} MB/s (element-wise {:>8.1f} MB/s), "
+              "load {:>8.1f} MB/s (element-wise {:>8.1f} MB/s)",
+              name, save_bulk, save_single, load_bulk, load_single);
+}
+
+} // namespace
+
+int caf_main(actor_system& sys, const config& cfg) {
+  auto elements = get_or(cfg, "elements", default_elements);
+  auto runs = get_or(cfg, "runs", default_runs);
+  run<int16_t>(sys, "int16_t", elements, runs);
+  run<int32_t>(sys, "int32_t", elements, runs);
+  run<int64_t>(sys, "int64_t", elements, runs);
+  run<float>(sys, "float", elements, runs);
+  run<double>(sys, "double", elements, runs);
+  return EXIT_SUCCESS;
+}
+
+CAF_MAIN()
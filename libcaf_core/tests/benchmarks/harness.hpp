@@ -0,0 +1,83 @@
+// Shared scaffolding for benchmarks that repeat a measurement a configurable
+// number of times.
+
+#pragma once
+
+#include "caf/actor.hpp"
+#include "caf/actor_cast.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/behavior.hpp"
+#include "caf/event_based_actor.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+namespace caf::benchmarks {
+
+/// Base type for the config of a benchmark. Adds the option `runs` to the
+/// global options.
+struct config_base : actor_system_config {
+  config_base() {
+    opt_group{custom_options_, "global"} //
+      .add<size_t>("runs,r", "number of runs per measurement");
+  }
+};
+
+/// Runs `fn` `runs` times and returns the elapsed time in seconds. Aborts the
+/// program if `fn` returns `false`.
+template <class F>
+double measure(size_t runs, F&& fn) {
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < runs; ++i)
+    if (!fn()) {
+      fprintf(stderr, "benchmark run failed\n");
+      abort();
+    }
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(stop - start).count();
+}
+
+/// Runs `fn` `runs` times and returns the throughput in MB/s.
+template <class F>
+double measure_throughput(size_t runs, size_t bytes_per_run, F&& fn) {
+  auto elapsed = measure(runs, fn);
+  return static_cast<double>(runs * bytes_per_run) / elapsed / 1e6;
+}
+
+/// Runs `fn` `runs` times and returns the average time per item in ns.
+template <class F>
+double measure_per_item(size_t runs, size_t items_per_run, F&& fn) {
+  auto elapsed = measure(runs, fn);
+  return elapsed * 1e9 / static_cast<double>(runs * items_per_run);
+}
+
+/// Answers each integer with the same integer.
+inline behavior pong(event_based_actor* self) {
+  return {
+    [self](int32_t value) {
+      self->mail(value).send(actor_cast<actor>(self->current_sender()));
+    },
+  };
+}
+
+/// Sends integers to `buddy` until receiving `rounds` and then sends `ok` to
+/// `listener`.
+inline behavior ping(event_based_actor* self, actor buddy, actor listener,
+                     int32_t rounds) {
+  self->mail(int32_t{1}).send(buddy);
+  return {
+    [self, buddy, listener, rounds](int32_t value) {
+      if (value == rounds) {
+        self->mail(ok_atom_v).send(listener);
+        self->quit();
+        return;
+      }
+      self->mail(value + 1).send(buddy);
+    },
+  };
+}
+
+} // namespace caf::benchmarks
@@ -0,0 +1,87 @@
+// Measures how fast the JSON writer renders a large array of doubles. For
+// comparison, also measures the previous approach of converting each value
+// with std::to_string and dropping trailing zeros afterwards.
+
+#include "harness.hpp"
+
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/caf_main.hpp"
+#include "caf/json_writer.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace caf;
+using namespace caf::benchmarks;
+
+namespace {
+
+constexpr size_t default_values = 1'000'000;
+
+constexpr size_t default_runs = 10;
+
+struct config : config_base {
+  config() {
+    opt_group{custom_options_, "global"} //
+      .add<size_t>("values,n", "number of doubles in the array");
+  }
+};
+
+// Renders `xs` as JSON array the way CAF did before using std::to_chars.
+void print_legacy(std::string& out, const std::vector<double>& xs) {
+  out.clear();
+  out += '[';
+  for (size_t i = 0; i < xs.size(); ++i) {
+    if (i > 0)
+      out += ", ";
+    auto str = std::to_string(xs[i]);
+    if (str.find('.') != std::string::npos) {
+      while (str.back() == '0')
+        str.pop_back();
+      if (str.back() == '.')
+        str.pop_back();
+    }
+    out += str;
+  }
+  out += ']';
+}
+
+} // namespace
+
+int caf_main(actor_system& sys, const config& cfg) {
+  auto values = get_or(cfg, "values", default_values);
+  auto runs = get_or(cfg, "runs", default_runs);
+  // Mix values of different magnitudes to cover both fixed and scientific
+  // notation in the output.
+  std::minstd_rand rng{42};
+  std::uniform_real_distribution<double> mantissa{-1.0, 1.0};
+  std::uniform_int_distribution<int> exponent{-12, 12};
+  std::vector<double> xs;
+  xs.reserve(values);
+  for (size_t i = 0; i < values; ++i)
+    xs.push_back(mantissa(rng) * std::pow(10.0, exponent(rng)));
+  json_writer writer;
+  size_t output_size = 0;
+  auto shortest = measure_per_item(runs, values, [&] {
+    writer.reset();
+    auto ok = writer.apply(xs);
+    output_size = writer.str().size();
+    return ok;
+  });
+  std::string legacy_out;
+  auto legacy = measure_per_item(runs, values, [&] {
+    print_legacy(legacy_out, xs);
+    return true;
+  });
+  sys.println("json_writer: {:.1f} ns/value ({} bytes)", shortest,
+              output_size);
+  sys.println("to_string:   {:.1f} ns/value ({} bytes, lossy)", legacy,
+              legacy_out.size());
+  return EXIT_SUCCESS;
+}
+
+CAF_MAIN()
@@ -0,0 +1,90 @@
+// Measures how fast the JSON reader looks up the fields of a large object.
+// Reads all fields of an object with 200 fields in declaration order, in
+// reverse order and in random order. Only the first case hits the cursor, the
+// other cases use the hash index of the reader.
+
+#include "harness.hpp"
+
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/caf_main.hpp"
+#include "caf/json_reader.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace caf;
+using namespace caf::benchmarks;
+
+namespace {
+
+constexpr size_t default_fields = 200;
+
+constexpr size_t default_runs = 10'000;
+
+struct config : config_base {
+  config() {
+    opt_group{custom_options_, "global"} //
+      .add<size_t>("fields,n", "number of fields in the object");
+  }
+};
+
+// Reads the fields `names` from the object at the current position.
+bool read_fields(json_reader& reader, const std::vector<std::string>& names) {
+  if (!reader.begin_object(invalid_type_id, "object"))
+    return false;
+  for (const auto& name : names) {
+    auto val = int64_t{0};
+    if (!reader.begin_field(name) || !reader.value(val) || !reader.end_field())
+      return false;
+  }
+  return reader.end_object();
+}
+
+} // namespace
+
+int caf_main(actor_system& sys, const config& cfg) {
+  auto fields = get_or(cfg, "fields", default_fields);
+  auto runs = get_or(cfg, "runs", default_runs);
+  std::vector<std::string> names;
+  std::string input = "{";
+  for (size_t i = 0; i < fields; ++i) {
+    names.push_back("field_" + std::to_string(i));
+    if (i > 0)
+      input += ", ";
+    input += '"';
+    input += names.back();
+    input += "\": ";
+    input += std::to_string(i);
+  }
+  input += '}';
+  json_reader reader;
+  if (!reader.load(input)) {
+    fprintf(stderr, "failed to load the input\n");
+    return EXIT_FAILURE;
+  }
+  auto run = [&](const std::vector<std::string>& order) {
+    return measure_per_item(runs, fields, [&] {
+      reader.revert();
+      return read_fields(reader, order);
+    });
+  };
+  auto in_order = run(names);
+  auto reversed = names;
+  std::reverse(reversed.begin(), reversed.end());
+  auto in_reverse = run(reversed);
+  auto shuffled = names;
+  std::shuffle(shuffled.begin(), shuffled.end(), std::minstd_rand{42});
+  auto in_random_order = run(shuffled);
+  sys.println("declaration order: {:>6.1f} ns/field", in_order);
+  sys.println("reverse order:     {:>6.1f} ns/field", in_reverse);
+  sys.println("random order:      {:>6.1f} ns/field", in_random_order);
+  return EXIT_SUCCESS;
+}
+
+CAF_MAIN()
@@ -0,0 +1,118 @@
+// Measures how fast CAF parses numeric-heavy JSON documents and individual
+// floating point numbers. For comparison, also measures converting the same
+// numbers with std::strtod.
+
+#include "harness.hpp"
+
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/caf_main.hpp"
+#include "caf/config_value.hpp"
+#include "caf/json_reader.hpp"
+#include "caf/json_writer.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace caf;
+using namespace caf::benchmarks;
+
+namespace {
+
+constexpr size_t default_values = 1'000'000;
+
+constexpr size_t default_runs = 10;
+
+struct config : config_base {
+  config() {
+    opt_group{custom_options_, "global"} //
+      .add<size_t>("values,n", "number of doubles in the documents");
+  }
+};
+
+// Renders `xs` as a JSON array of objects with three numeric fields each.
+std::string make_records(const std::vector<double>& xs) {
+  std::string result = "[";
+  for (size_t i = 0; i + 2 < xs.size(); i += 3) {
+    if (i > 0)
+      result += ", ";
+    result += R"({"x": )";
+    result += deep_to_string(xs[i]);
+    result += R"(, "y": )";
+    result += deep_to_string(xs[i + 1]);
+    result += R"(, "z": )";
+    result += deep_to_string(xs[i + 2]);
+    result += '}';
+  }
+  result += ']';
+  return result;
+}
+
+} // namespace
+
+int caf_main(actor_system& sys, const config& cfg) {
+  auto values = get_or(cfg, "values", default_values);
+  auto runs = get_or(cfg, "runs", default_runs);
+  // Mix values of different magnitudes and precision to cover short numbers
+  // as well as numbers that require all 17 significant digits.
+  std::minstd_rand rng{42};
+  std::uniform_real_distribution<double> mantissa{-1.0, 1.0};
+  std::uniform_int_distribution<int> exponent{-12, 12};
+  std::vector<double> xs;
+  xs.reserve(values);
+  for (size_t i = 0; i < values; ++i) {
+    auto x = mantissa(rng) * std::pow(10.0, exponent(rng));
+    if (i % 2 == 0)
+      x = std::round(x * 1000.0) / 1000.0;
+    xs.push_back(x);
+  }
+  // Document 1: a flat array of numbers.
+  json_writer writer;
+  if (!writer.apply(xs)) {
+    fprintf(stderr, "failed to render the array\n");
+    return EXIT_FAILURE;
+  }
+  auto array = std::string{writer.str()};
+  json_reader reader;
+  std::vector<double> ys;
+  auto array_mbs = measure_throughput(runs, array.size(), [&] {
+    return reader.load(array) && reader.apply(ys) && ys.size() == xs.size();
+  });
+  // Document 2: an array of records with numeric fields.
+  auto records = make_records(xs);
+  auto records_mbs = measure_throughput(runs, records.size(),
+                                        [&] { return reader.load(records); });
+  // Individual numbers: config_value::parse vs. std::strtod.
+  std::vector<std::string> strs;
+  strs.reserve(xs.size());
+  size_t total_size = 0;
+  for (auto x : xs) {
+    strs.push_back(deep_to_string(x));
+    total_size += strs.back().size();
+  }
+  auto parse_mbs = measure_throughput(runs, total_size, [&] {
+    for (const auto& str : strs)
+      if (!config_value::parse(str))
+        return false;
+    return true;
+  });
+  auto strtod_mbs = measure_throughput(runs, total_size, [&] {
+    auto sum = 0.0;
+    for (const auto& str : strs)
+      sum += std::strtod(str.c_str(), nullptr);
+    return !std::isnan(sum);
+  });
+  sys.println("json_reader (array):   {:>8.1f} MB/s ({} bytes)", array_mbs,
+              array.size());
+  sys.println("json_reader (records): {:>8.1f} MB/s ({} bytes)", records_mbs,
+              records.size());
+  sys.println("config_value::parse:   {:>8.1f} MB/s", parse_mbs);
+  sys.println("std::strtod:           {:>8.1f} MB/s", strtod_mbs);
+  return EXIT_SUCCESS;
+}
+
+CAF_MAIN()
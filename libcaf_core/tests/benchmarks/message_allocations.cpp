@@ -0,0 +1,111 @@
+// Counts heap allocations per message while a pair of actors sends messages
+// back and forth. Builds with CAF_ENABLE_MESSAGE_POOL should converge to (close
+// to) zero allocations per message, whereas builds without the message pool
+// allocate the mailbox element and the message data for each message.
+
+#include "harness.hpp"
+
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/caf_main.hpp"
+#include "caf/scoped_actor.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+using namespace caf;
+using namespace caf::benchmarks;
+
+namespace {
+
+std::atomic<size_t> allocations;
+
+void* counted_alloc(size_t size) noexcept {
+  allocations.fetch_add(1, std::memory_order_relaxed);
+  return malloc(size == 0 ? 1 : size);
+}
+
+} // namespace
+
+void* operator new(size_t size) {
+  if (auto* ptr = counted_alloc(size))
+    return ptr;
+  throw std::bad_alloc{};
+}
+
+void* operator new[](size_t size) {
+  if (auto* ptr = counted_alloc(size))
+    return ptr;
+  throw std::bad_alloc{};
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+  return counted_alloc(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+  return counted_alloc(size);
+}
+
+void operator delete(void* ptr) noexcept {
+  free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+  free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+  free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+  free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+  free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+  free(ptr);
+}
+
+namespace {
+
+constexpr size_t default_messages = 1'000'000;
+
+constexpr size_t default_runs = 1;
+
+struct config : config_base {
+  config() {
+    opt_group{custom_options_, "global"} //
+      .add<size_t>("messages,m", "number of messages to send");
+  }
+};
+
+} // namespace
+
+int caf_main(actor_system& sys, const config& cfg) {
+  auto messages = get_or(cfg, "messages", default_messages);
+  auto runs = get_or(cfg, "runs", default_runs);
+  auto rounds = static_cast<int32_t>(messages / 2);
+  scoped_actor self{sys};
+  auto buddy = sys.spawn(pong);
+  auto before = allocations.load();
+  auto elapsed = measure(runs, [&] {
+    sys.spawn(ping, buddy, actor{self}, rounds);
+    self->receive([](ok_atom) {});
+    return true;
+  });
+  auto total = allocations.load() - before;
+  auto sent = static_cast<size_t>(rounds) * 2 * runs;
+  auto per_message = static_cast<double>(total) / static_cast<double>(sent);
+  sys.println("{} messages in {:.0f} ms: {} heap allocations ({:.3f} each)",
+              sent, elapsed * 1e3, total, per_message);
+  return EXIT_SUCCESS;
+}
+
+CAF_MAIN()
@@ -0,0 +1,58 @@
+// Measures the round-trip latency between pairs of actors that send a single
+// message back and forth. Compare scheduler settings by passing them on the
+// command line, for example:
+//
+//   caf-core-ping-pong-benchmark --caf.scheduler.policy=lock-free-stealing
+//   caf-core-ping-pong-benchmark --caf.work-stealing.max-lifo-polls=0
+
+#include "harness.hpp"
+
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/caf_main.hpp"
+#include "caf/scoped_actor.hpp"
+
+#include <cstdint>
+
+using namespace caf;
+using namespace caf::benchmarks;
+
+namespace {
+
+constexpr size_t default_rounds = 100'000;
+
+constexpr size_t default_pairs = 1;
+
+constexpr size_t default_runs = 1;
+
+struct config : config_base {
+  config() {
+    opt_group{custom_options_, "global"}
+      .add<size_t>("rounds,n", "number of round trips per pair")
+      .add<size_t>("pairs,p", "number of concurrent ping-pong pairs");
+  }
+};
+
+} // namespace
+
+int caf_main(actor_system& sys, const config& cfg) {
+  auto rounds = get_or(cfg, "rounds", default_rounds);
+  auto pairs = get_or(cfg, "pairs", default_pairs);
+  auto runs = get_or(cfg, "runs", default_runs);
+  scoped_actor self{sys};
+  auto total = rounds * pairs;
+  auto latency = measure_per_item(runs, total, [&] {
+    for (size_t i = 0; i < pairs; ++i) {
+      auto buddy = sys.spawn(pong);
+      sys.spawn(ping, buddy, actor{self}, static_cast<int32_t>(rounds));
+    }
+    for (size_t i = 0; i < pairs; ++i)
+      self->receive([](ok_atom) {});
+    return true;
+  });
+  sys.println("{} round trips: {:.1f} ns per round trip", total * runs,
+              latency);
+  return EXIT_SUCCESS;
+}
+
+CAF_MAIN()
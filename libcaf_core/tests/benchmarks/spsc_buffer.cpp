@@ -0,0 +1,157 @@
+// Measures the item throughput of an SPSC buffer with one producer thread and
+// one consumer thread for both storage modes. Like a flow, the producer only
+// pushes items after the consumer signaled demand and the consumer pulls up to
+// defaults::flow::batch_size items at once.
+
+#include "harness.hpp"
+
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/async/spsc_buffer.hpp"
+#include "caf/caf_main.hpp"
+#include "caf/defaults.hpp"
+#include "caf/intrusive_ptr.hpp"
+#include "caf/make_counted.hpp"
+#include "caf/ref_counted.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+using namespace caf;
+using namespace caf::benchmarks;
+
+namespace {
+
+constexpr size_t default_items = 10'000'000;
+
+constexpr size_t default_runs = 1;
+
+struct config : config_base {
+  config() {
+    opt_group{custom_options_, "global"} //
+      .add<size_t>("items,n", "number of items per run");
+  }
+};
+
+class producer_impl : public ref_counted, public async::producer {
+public:
+  void on_consumer_ready() override {
+    // nop
+  }
+
+  void on_consumer_cancel() override {
+    // nop
+  }
+
+  void on_consumer_demand(size_t demand) override {
+    credit.fetch_add(demand, std::memory_order_release);
+  }
+
+  void ref_producer() const noexcept override {
+    ref();
+  }
+
+  void deref_producer() const noexcept override {
+    deref();
+  }
+
+  std::atomic<size_t> credit = 0;
+
+  CAF_INTRUSIVE_PTR_FRIENDS(producer_impl)
+};
+
+class consumer_impl : public ref_counted, public async::consumer {
+public:
+  void on_producer_ready() override {
+    // nop
+  }
+
+  void on_producer_wakeup() override {
+    // nop: the consumer thread polls the buffer
+  }
+
+  void ref_consumer() const noexcept override {
+    ref();
+  }
+
+  void deref_consumer() const noexcept override {
+    deref();
+  }
+
+  CAF_INTRUSIVE_PTR_FRIENDS(consumer_impl)
+};
+
+struct observer {
+  void on_next(const int64_t& item) {
+    sum += item;
+  }
+
+  void on_complete() {
+    done = true;
+  }
+
+  void on_error(const error&) {
+    done = true;
+  }
+
+  int64_t sum = 0;
+  bool done = false;
+};
+
+// Moves `items` items through a new buffer and returns the checksum.
+int64_t transfer(async::spsc_buffer_mode mode, size_t items) {
+  auto buf = make_counted<async::spsc_buffer<int64_t>>(
+    defaults::flow::buffer_size, defaults::flow::min_demand, mode);
+  auto prod = make_counted<producer_impl>();
+  buf->set_producer(prod);
+  buf->set_consumer(make_counted<consumer_impl>());
+  std::thread producer_thread{[buf, prod, items] {
+    size_t pushed = 0;
+    while (pushed < items) {
+      auto credit = prod->credit.exchange(0, std::memory_order_acquire);
+      if (credit == 0) {
+        std::this_thread::yield();
+        continue;
+      }
+      for (auto n = std::min(credit, items - pushed); n > 0; --n)
+        buf->push(static_cast<int64_t>(pushed++));
+    }
+    buf->close();
+  }};
+  observer obs;
+  while (!obs.done) {
+    auto [again, pulled] = buf->pull(async::delay_errors,
+                                     defaults::flow::batch_size, obs);
+    if (!again)
+      break;
+    if (pulled == 0)
+      std::this_thread::yield();
+  }
+  producer_thread.join();
+  return obs.sum;
+}
+
+void run(actor_system& sys, const char* name, async::spsc_buffer_mode mode,
+         size_t items, size_t runs) {
+  // The producer pushes 0, 1, ..., items - 1.
+  auto n = static_cast<int64_t>(items);
+  auto expected = n * (n - 1) / 2;
+  auto ns = measure_per_item(runs, items, [&] {
+    return transfer(mode, items) == expected;
+  });
+  sys.println("{:>9}: {:.2f} M items/s", name, 1e3 / ns);
+}
+
+} // namespace
+
+int caf_main(actor_system& sys, const config& cfg) {
+  auto items = get_or(cfg, "items", default_items);
+  auto runs = get_or(cfg, "runs", default_runs);
+  run(sys, "locked", async::spsc_buffer_mode::locked, items, runs);
+  run(sys, "lock-free", async::spsc_buffer_mode::lock_free, items, runs);
+  return EXIT_SUCCESS;
+}
+
+CAF_MAIN()
@@ -0,0 +1,130 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/io/basp/direct_actor_proxy.hpp"
+
+#include "caf/io/basp/header.hpp"
+#include "caf/io/basp/instance.hpp"
+#include "caf/io/basp/message_type.hpp"
+
+#include "caf/action.hpp"
+#include "caf/actor_registry.hpp"
+#include "caf/actor_system.hpp"
+#include "caf/binary_serializer.hpp"
+#include "caf/byte_buffer.hpp"
+#include "caf/callback.hpp"
+#include "caf/detail/assert.hpp"
+#include "caf/detail/current_actor.hpp"
+#include "caf/log/io.hpp"
+#include "caf/mailbox_element.hpp"
+#include "caf/system_messages.hpp"
+
+#include <mutex>
+#include <utility>
+
+namespace caf::io::basp {
+
+// -- constructors, destructors, and assignment operators ----------------------
+
+direct_actor_proxy::direct_actor_proxy(actor_config& cfg, actor dest,
+                                       outbound_queue_ptr queue)
+  : super(cfg, dest), queue_(std::move(queue)), broker_(std::move(dest)) {
+  // nop
+}
+
+direct_actor_proxy::~direct_actor_proxy() {
+  // nop
+}
+
+// -- overrides ----------------------------------------------------------------
+
+bool direct_actor_proxy::enqueue(mailbox_element_ptr what, scheduler* sched) {
+  CAF_ASSERT(what);
+  // Messages from remote senders require a routed message. They always go
+  // through the broker, so there is no other path they could overtake.
+  auto& src = what->sender;
+  if (src && src->node() != home_system().node())
+    return super::enqueue(std::move(what), sched);
+  outbound_queue_ptr queue;
+  actor broker;
+  { // Lifetime scope of guard.
+    std::shared_lock guard{queue_mtx_};
+    queue = queue_;
+    broker = broker_;
+  }
+  if (!queue)
+    return super::enqueue(std::move(what), sched);
+  // Exit messages require the proxy to unlink first, so they go through the
+  // broker. Messages must not overtake messages that are still waiting in the
+  // mailbox of the broker.
+  if (!what->payload.match_elements<exit_msg>()
+      && pending_.load(std::memory_order_acquire) == 0) {
+    detail::current_actor_guard ctx_guard{nullptr};
+    if (write_direct(*queue, *what, sched))
+      return true;
+  }
+  return forward_to_broker(broker, std::move(what), sched);
+}
+
+void direct_actor_proxy::kill_proxy(scheduler* sched, error rsn) {
+  outbound_queue_ptr tmp;
+  actor broker;
+  { // Lifetime scope of guard.
+    std::unique_lock guard{queue_mtx_};
+    queue_.swap(tmp);
+    broker_.swap(broker); // Manually break the cycle.
+  }
+  super::kill_proxy(sched, std::move(rsn));
+}
+
+// -- utility functions --------------------------------------------------------
+
+bool direct_actor_proxy::write_direct(outbound_queue& queue,
+                                      mailbox_element& what, scheduler* sched) {
+  auto lg = log::io::trace("id = {}, sender = {}, mid = {}, msg = {}", id(),
+                           what.sender, what.mid, what.payload);
+  auto& sys = home_system();
+  auto& src = what.sender;
+  // Make sure the receiver can reach the sender, e.g., to send a response.
+  if (src)
+    sys.registry().put(src->id(), src);
+  header hdr{message_type::direct_message,
+             0,
+             0,
+             what.mid.integer_value(),
+             src ? src->id() : invalid_actor_id,
+             id()};
+  auto writer = make_callback([&what](binary_serializer& sink) { //
+    return sink.apply(what.payload);
+  });
+  byte_buffer buf;
+  instance::reserve(buf, what.payload);
+  instance::write(sys, sched, buf, hdr, &writer);
+  if (buf.size() != header_size + hdr.payload_len) {
+    // Serialization failed and `write` already logged the error. Drop the
+    // message instead of passing it to the broker, which would fail as well.
+    return true;
+  }
+  return queue.push(std::move(buf));
+}
+
+bool direct_actor_proxy::forward_to_broker(const actor& broker,
+                                           mailbox_element_ptr what,
+                                           scheduler* sched) {
+  pending_.fetch_add(1, std::memory_order_relaxed);
+  auto result = super::enqueue(std::move(what), sched);
+  // The broker runs this action after dispatching the message, i.e., after it
+  // wrote the message to the same connection as the outbound queue.
+  auto done = make_action([ptr = strong_actor_ptr{ctrl(), add_ref}] {
+    auto self = static_cast<direct_actor_proxy*>(ptr->get());
+    self->pending_.fetch_sub(1, std::memory_order_release);
+  });
+  if (!broker->enqueue(make_mailbox_element(nullptr, make_message_id(),
+                                            std::move(done)),
+                       sched))
+    pending_.fetch_sub(1, std::memory_order_release);
+  return result;
+}
+
+} // namespace caf::io::basp
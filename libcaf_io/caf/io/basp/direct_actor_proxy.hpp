@@ -0,0 +1,67 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/io/basp/outbound_queue.hpp"
+
+#include "caf/detail/io_export.hpp"
+#include "caf/forwarding_actor_proxy.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <shared_mutex>
+
+namespace caf::io::basp {
+
+/// A proxy for an actor on a directly connected node. Serializes messages from
+/// local senders on the calling thread and appends them to the outbound queue
+/// of the connection. Falls back to forwarding messages to the BASP broker
+/// for all other messages or after the connection has been closed. As long as
+/// the broker has messages from this proxy in its mailbox, all messages go
+/// through the broker to preserve their order.
+class CAF_IO_EXPORT direct_actor_proxy : public forwarding_actor_proxy {
+public:
+  // -- member types -----------------------------------------------------------
+
+  using super = forwarding_actor_proxy;
+
+  // -- constructors, destructors, and assignment operators --------------------
+
+  direct_actor_proxy(actor_config& cfg, actor dest, outbound_queue_ptr queue);
+
+  ~direct_actor_proxy() override;
+
+  // -- overrides --------------------------------------------------------------
+
+  bool enqueue(mailbox_element_ptr what, scheduler* sched) override;
+
+  void kill_proxy(scheduler* sched, error rsn) override;
+
+private:
+  /// Serializes `what` and appends it to `queue_`.
+  /// @returns `false` if the queue has been closed, `true` otherwise.
+  bool write_direct(outbound_queue& queue, mailbox_element& what,
+                    scheduler* sched);
+
+  /// Forwards `what` to the BASP broker and keeps track of the message until
+  /// the broker has dispatched it.
+  bool forward_to_broker(const actor& broker, mailbox_element_ptr what,
+                         scheduler* sched);
+
+  /// Protects `queue_` and `broker_`.
+  mutable std::shared_mutex queue_mtx_;
+
+  /// Points to the outbound queue of the connection.
+  outbound_queue_ptr queue_;
+
+  /// Points to the BASP broker.
+  actor broker_;
+
+  /// Counts messages from local senders that wait in the mailbox of the BASP
+  /// broker.
+  std::atomic<size_t> pending_ = 0;
+};
+
+} // namespace caf::io::basp
@@ -0,0 +1,152 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/io/basp/direct_actor_proxy.hpp"
+
+#include "caf/test/test.hpp"
+
+#include "caf/io/middleman.hpp"
+
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/event_based_actor.hpp"
+#include "caf/scoped_actor.hpp"
+
+#include <memory>
+
+using namespace caf;
+using namespace std::literals;
+
+namespace {
+
+struct config : actor_system_config {
+  explicit config(bool direct_send) {
+    load<io::middleman>();
+    set("caf.middleman.enable-direct-send", direct_send);
+  }
+};
+
+// Doubles its inputs and keeps track of whether they arrived in order. Exit
+// messages carry their position in the sequence as context of the reason.
+behavior collector(event_based_actor* self) {
+  auto next = std::make_shared<int32_t>(0);
+  auto in_order = std::make_shared<bool>(true);
+  self->set_exit_handler([next, in_order](exit_msg& msg) {
+    auto& ctx = msg.reason.context();
+    if (!ctx.match_elements<int32_t>() || ctx.get_as<int32_t>(0) != (*next)++)
+      *in_order = false;
+  });
+  return {
+    [next, in_order](int32_t x) {
+      if (x != (*next)++)
+        *in_order = false;
+      return x * 2;
+    },
+    [next, in_order](get_atom) { return make_message(*next, *in_order); },
+  };
+}
+
+struct fixture {
+  config server_cfg{false};
+  actor_system server{server_cfg};
+  config client_cfg{true};
+  actor_system client{client_cfg};
+  actor server_actor;
+  actor remote;
+
+  fixture() {
+    server_actor = server.spawn(collector);
+    auto port = server.middleman().publish(server_actor, 0);
+    if (!port)
+      CAF_RAISE_ERROR("failed to publish the collector");
+    auto hdl = client.middleman().remote_actor("localhost", *port);
+    if (!hdl)
+      CAF_RAISE_ERROR("failed to connect to the collector");
+    remote = *hdl;
+  }
+
+  ~fixture() {
+    // The collector handles regular exit messages, so it only stops on kill.
+    anon_send_exit(server_actor, exit_reason::kill);
+  }
+};
+
+} // namespace
+
+WITH_FIXTURE(fixture) {
+
+TEST("proxies to directly connected nodes bypass the broker") {
+  auto ptr = actor_cast<abstract_actor*>(remote);
+  check(dynamic_cast<io::basp::direct_actor_proxy*>(ptr) != nullptr);
+}
+
+TEST("proxies preserve the order of messages and deliver responses") {
+  scoped_actor self{client};
+  for (int32_t i = 0; i < 100; ++i)
+    self->mail(i).send(remote);
+  for (int32_t i = 0; i < 100; ++i) {
+    self->receive([this, i](int32_t x) { check_eq(x, i * 2); },
+                  after(10s) >> [this] { fail("timeout"); });
+  }
+  self->mail(get_atom_v)
+    .request(remote, 10s)
+    .receive(
+      [this](int32_t num, bool in_order) {
+        check_eq(num, 100);
+        check(in_order);
+      },
+      [this](const error& err) { fail("request failed: {}", err); });
+}
+
+TEST("proxies preserve the order of messages that go through the broker") {
+  // Exit messages always go through the broker, while all other messages go
+  // to the connection directly unless they would overtake an exit message.
+  scoped_actor self{client};
+  for (int32_t i = 0; i < 100; ++i) {
+    if (i % 10 == 0)
+      self->send_exit(remote, make_error(exit_reason::user_shutdown, i));
+    else
+      self->mail(i).send(remote);
+  }
+  for (int32_t i = 0; i < 100; ++i) {
+    if (i % 10 == 0)
+      continue;
+    self->receive([this, i](int32_t x) { check_eq(x, i * 2); },
+                  after(10s) >> [this] { fail("timeout"); });
+  }
+  self->mail(get_atom_v)
+    .request(remote, 10s)
+    .receive(
+      [this](int32_t num, bool in_order) {
+        check_eq(num, 100);
+        check(in_order);
+      },
+      [this](const error& err) { fail("request failed: {}", err); });
+}
+
+TEST("exit messages never overtake messages that went to the connection") {
+  // Every exit message follows a message that took the direct path and may
+  // still wait in the outbound queue when the broker writes the exit message.
+  scoped_actor self{client};
+  for (int32_t i = 0; i < 100; ++i) {
+    if (i % 2 == 1)
+      self->send_exit(remote, make_error(exit_reason::user_shutdown, i));
+    else
+      self->mail(i).send(remote);
+  }
+  for (int32_t i = 0; i < 100; i += 2) {
+    self->receive([this, i](int32_t x) { check_eq(x, i * 2); },
+                  after(10s) >> [this] { fail("timeout"); });
+  }
+  self->mail(get_atom_v)
+    .request(remote, 10s)
+    .receive(
+      [this](int32_t num, bool in_order) {
+        check_eq(num, 100);
+        check(in_order);
+      },
+      [this](const error& err) { fail("request failed: {}", err); });
+}
+
+} // WITH_FIXTURE(fixture)
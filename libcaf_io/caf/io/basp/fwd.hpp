@@ -11,6 +11,8 @@ struct header;
 class worker;
 class worker_hub;
 class message_queue;
+class outbound_queue;
+class direct_actor_proxy;
 class instance;
 class routing_table;
 
@@ -180,7 +180,9 @@ bool instance::dispatch(scheduler* ctx, const strong_actor_ptr& sender,
     auto writer = make_callback([&](binary_serializer& sink) { //
       return sink.apply(msg);
     });
-    write(*sys_, ctx, callee_.get_buffer(path->hdl), hdr, &writer);
+    auto& buf = callee_.get_buffer(path->hdl);
+    reserve(buf, msg);
+    write(*sys_, ctx, buf, hdr, &writer);
   } else {
     header hdr{message_type::routed_message,
                flags,
@@ -196,7 +198,9 @@ bool instance::dispatch(scheduler* ctx, const strong_actor_ptr& sender,
              && sink.apply(dest_node) //
              && sink.apply(msg);
     });
-    write(*sys_, ctx, callee_.get_buffer(path->hdl), hdr, &writer);
+    auto& buf = callee_.get_buffer(path->hdl);
+    reserve(buf, source_node, dest_node, msg);
+    write(*sys_, ctx, buf, hdr, &writer);
   }
   flush(*path);
   return true;
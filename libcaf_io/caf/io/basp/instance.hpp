@@ -13,6 +13,7 @@
 #include "caf/io/middleman.hpp"
 
 #include "caf/actor_system_config.hpp"
+#include "caf/binary_size_calculator.hpp"
 #include "caf/byte_buffer.hpp"
 #include "caf/callback.hpp"
 #include "caf/detail/io_export.hpp"
@@ -20,6 +21,7 @@
 #include "caf/error.hpp"
 #include "caf/proxy_registry.hpp"
 
+#include <algorithm>
 #include <limits>
 
 namespace caf::io::basp {
@@ -162,6 +164,27 @@ public:
     return published_actors_;
   }
 
+  /// Minimum free capacity of a buffer that allows `reserve` to skip computing
+  /// the payload size. Most messages fit into this space, so we avoid walking
+  /// their content twice.
+  static constexpr size_t reserve_threshold = 1024;
+
+  /// Reserves space in `buf` for a header followed by a payload that consists
+  /// of `xs` unless `buf` has at least `reserve_threshold` bytes of free
+  /// capacity. Grows `buf` geometrically to keep appending to the same buffer
+  /// in amortized linear time.
+  template <class... Ts>
+  static void reserve(byte_buffer& buf, const Ts&... xs) {
+    if (buf.capacity() - buf.size() >= reserve_threshold)
+      return;
+    binary_size_calculator calc;
+    if (!(calc.apply(xs) && ...))
+      return;
+    auto required = buf.size() + header_size + calc.result();
+    if (required > buf.capacity())
+      buf.reserve(std::max(required, 2 * buf.capacity()));
+  }
+
   /// Writes a header followed by its payload to `storage`.
   static void write(actor_system& sys, scheduler* ctx, byte_buffer& buf,
                     header& hdr, payload_writer* pw = nullptr);
@@ -0,0 +1,79 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/io/basp/outbound_queue.hpp"
+
+#include "caf/io/abstract_broker.hpp"
+#include "caf/io/network/multiplexer.hpp"
+
+#include "caf/log/io.hpp"
+
+namespace caf::io::basp {
+
+// -- constructors, destructors, and assignment operators ----------------------
+
+outbound_queue::outbound_queue(abstract_broker* broker, connection_handle hdl)
+  : broker_(broker), mpx_(&broker->backend()), hdl_(hdl) {
+  // nop
+}
+
+outbound_queue::~outbound_queue() {
+  // nop
+}
+
+// -- properties ---------------------------------------------------------------
+
+bool outbound_queue::closed() const {
+  std::unique_lock guard{mtx_};
+  return closed_;
+}
+
+// -- mutators -----------------------------------------------------------------
+
+bool outbound_queue::push(byte_buffer&& buf) {
+  { // Lifetime scope of guard.
+    std::unique_lock guard{mtx_};
+    if (closed_)
+      return false;
+    if (buf_.empty())
+      buf_.swap(buf);
+    else
+      buf_.insert(buf_.end(), buf.begin(), buf.end());
+    if (scheduled_)
+      return true;
+    scheduled_ = true;
+  }
+  mpx_->post([ptr = outbound_queue_ptr{this, add_ref}] { ptr->ship(); });
+  return true;
+}
+
+void outbound_queue::ship() {
+  auto lg = log::io::trace("hdl = {}", hdl_);
+  byte_buffer tmp;
+  { // Lifetime scope of guard.
+    std::unique_lock guard{mtx_};
+    scheduled_ = false;
+    if (closed_ || buf_.empty())
+      return;
+    tmp.swap(buf_);
+  }
+  if (!broker_->valid(hdl_)) {
+    log::io::debug("drop {} bytes for a closed connection", tmp.size());
+    return;
+  }
+  auto& out = broker_->wr_buf(hdl_);
+  if (out.empty())
+    out.swap(tmp);
+  else
+    out.insert(out.end(), tmp.begin(), tmp.end());
+  broker_->flush(hdl_);
+}
+
+void outbound_queue::close() {
+  std::unique_lock guard{mtx_};
+  closed_ = true;
+  buf_.clear();
+}
+
+} // namespace caf::io::basp
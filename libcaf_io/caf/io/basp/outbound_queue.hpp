@@ -0,0 +1,86 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#pragma once
+
+#include "caf/io/connection_handle.hpp"
+#include "caf/io/fwd.hpp"
+
+#include "caf/byte_buffer.hpp"
+#include "caf/detail/io_export.hpp"
+#include "caf/intrusive_ptr.hpp"
+#include "caf/ref_counted.hpp"
+
+#include <mutex>
+
+namespace caf::io::basp {
+
+/// Collects serialized BASP messages for a single connection. Proxies append
+/// ready-to-write messages from any thread and the queue moves them to the
+/// write buffer of the connection in the event loop of the multiplexer, i.e.,
+/// without going through the mailbox of the BASP broker.
+class CAF_IO_EXPORT outbound_queue : public ref_counted {
+public:
+  // -- constructors, destructors, and assignment operators --------------------
+
+  outbound_queue(abstract_broker* broker, connection_handle hdl);
+
+  ~outbound_queue() override;
+
+  // -- properties -------------------------------------------------------------
+
+  /// Returns the handle of the connection for this queue.
+  connection_handle hdl() const noexcept {
+    return hdl_;
+  }
+
+  /// Returns whether the queue no longer accepts messages.
+  bool closed() const;
+
+  // -- mutators ---------------------------------------------------------------
+
+  /// Appends a serialized BASP message to the queue and schedules a flush of
+  /// the connection if necessary.
+  /// @returns `false` if the queue has been closed, `true` otherwise.
+  /// @threadsafe
+  bool push(byte_buffer&& buf);
+
+  /// Moves all pending messages to the write buffer of the connection. The
+  /// broker calls this function before writing to the connection itself, so
+  /// that its messages never overtake messages from the queue.
+  /// @pre must run in the event loop of the multiplexer.
+  void ship();
+
+  /// Stops accepting new messages and drops all pending messages.
+  /// @pre must run in the event loop of the multiplexer.
+  void close();
+
+private:
+  /// Protects `buf_`, `closed_` and `scheduled_`.
+  mutable std::mutex mtx_;
+
+  /// Points to the broker that owns the connection. Only valid as long as the
+  /// queue has not been closed.
+  abstract_broker* broker_;
+
+  /// Points to the multiplexer of the broker.
+  network::multiplexer* mpx_;
+
+  /// Identifies the connection.
+  connection_handle hdl_;
+
+  /// Stores serialized messages until the next flush.
+  byte_buffer buf_;
+
+  /// Signals whether the queue accepts new messages.
+  bool closed_ = false;
+
+  /// Signals whether a flush is already pending in the multiplexer.
+  bool scheduled_ = false;
+};
+
+/// @relates outbound_queue
+using outbound_queue_ptr = intrusive_ptr<outbound_queue>;
+
+} // namespace caf::io::basp
@@ -81,6 +81,9 @@ void basp_broker::on_exit() {
   node_observers.clear();
   // Release any obsolete state.
   ctx.clear();
+  for (auto& kvp : outbound_queues)
+    kvp.second->close();
+  outbound_queues.clear();
   // Make sure all spawn servers are down before clearing the container.
   for (auto& kvp : spawn_servers)
     anon_send_exit(kvp.second, exit_reason::kill);
@@ -112,6 +115,7 @@ behavior basp_broker::make_behavior() {
     }
     automatic_connections = true;
   }
+  direct_send = get_or(config(), "caf.middleman.enable-direct-send", false);
   auto heartbeat_interval = get_or(config(), "caf.middleman.heartbeat-interval",
                                    defaults::middleman::heartbeat_interval);
   if (heartbeat_interval.count() > 0) {
@@ -458,9 +462,16 @@ strong_actor_ptr basp_broker::make_proxy(node_id nid, actor_id aid) {
   // create proxy and add functor that will be called if we
   // receive a basp::down_message
   actor_config cfg{no_spawn_options};
-  auto res = make_actor<forwarding_actor_proxy, strong_actor_ptr>(aid, nid,
-                                                                  &(system()),
-                                                                  cfg, this);
+  strong_actor_ptr res;
+  // Proxies for directly connected nodes may bypass the broker when sending
+  // messages from local actors.
+  auto hdl = direct_send ? instance.tbl().lookup_direct(nid) : std::nullopt;
+  if (hdl)
+    res = make_actor<basp::direct_actor_proxy, strong_actor_ptr>(
+      aid, nid, &(system()), cfg, this, outbound_queue(*hdl));
+  else
+    res = make_actor<forwarding_actor_proxy, strong_actor_ptr>(
+      aid, nid, &(system()), cfg, this);
   strong_actor_ptr selfptr{ctrl(), add_ref};
   res->get()->attach_functor([=](const error& rsn) {
     mm->backend().post([=] {
@@ -685,6 +696,12 @@ void basp_broker::set_context(connection_handle hdl) {
 
 void basp_broker::connection_cleanup(connection_handle hdl, sec code) {
   auto lg = log::io::trace("hdl = {}, code = {}", hdl, code);
+  // Stop proxies from writing to this connection. Messages from proxies go
+  // through the broker from now on.
+  if (auto i = outbound_queues.find(hdl); i != outbound_queues.end()) {
+    i->second->close();
+    outbound_queues.erase(i);
+  }
   // Remove handle from the routing table, notify all observers, and clean up
   // any node-specific state we might still have.
   if (auto nid = instance.tbl().erase_direct(hdl)) {
@@ -706,7 +723,19 @@ void basp_broker::connection_cleanup(connection_handle hdl, sec code) {
   }
 }
 
+basp::outbound_queue_ptr basp_broker::outbound_queue(connection_handle hdl) {
+  auto& ptr = outbound_queues[hdl];
+  if (!ptr)
+    ptr = make_counted<basp::outbound_queue>(this, hdl);
+  return ptr;
+}
+
 byte_buffer& basp_broker::get_buffer(connection_handle hdl) {
+  // Messages from proxies that are still waiting in the outbound queue must go
+  // first. Otherwise, messages that took the detour through the broker could
+  // overtake earlier messages from the same sender.
+  if (auto i = outbound_queues.find(hdl); i != outbound_queues.end())
+    i->second->ship();
   return wr_buf(hdl);
 }
 
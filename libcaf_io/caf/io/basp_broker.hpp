@@ -41,6 +41,9 @@ public:
   using monitored_actor_map
     = std::unordered_map<actor_addr, std::unordered_set<node_id>>;
 
+  using outbound_queue_map
+    = std::unordered_map<connection_handle, basp::outbound_queue_ptr>;
+
   // -- constructors, destructors, and assignment operators --------------------
 
   explicit basp_broker(actor_config& cfg);
@@ -107,6 +110,9 @@ public:
   /// Sends a basp::down_message message to a remote node.
   void send_basp_down_message(const node_id& nid, actor_id aid, error err);
 
+  /// Returns the outbound queue for `hdl`, creating it on first access.
+  basp::outbound_queue_ptr outbound_queue(connection_handle hdl);
+
   // -- disambiguation for functions found in multiple base classes ------------
 
   actor_system& system() {
@@ -143,6 +149,13 @@ public:
   /// routing paths by forming a mesh between all nodes.
   bool automatic_connections = false;
 
+  /// Configures whether proxies for directly connected nodes serialize
+  /// messages on the sending thread instead of forwarding them to the broker.
+  bool direct_send = false;
+
+  /// Stores the outbound queues for proxies with a direct connection.
+  outbound_queue_map outbound_queues;
+
   /// Returns the node identifier of the underlying BASP instance.
   const node_id& this_node() const {
     return instance.this_node();
@@ -195,6 +195,8 @@ void middleman::add_module_options(actor_system_config& cfg) {
                    "(disabled if 0, ignored if heartbeats are disabled)")
     .add<bool>("attach-utility-actors",
                "schedule utility actors instead of dedicating threads")
+    .add<bool>("enable-direct-send",
+               "serialize messages to directly connected nodes in proxies")
     .add<size_t>("workers", "number of deserialization workers");
   config_option_adder{cfg.custom_options(), "caf.middleman.prometheus-http"}
     .add<uint16_t>("port", "listening port for incoming scrapes")
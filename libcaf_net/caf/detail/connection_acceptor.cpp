@@ -4,10 +4,24 @@
 
 #include "caf/detail/connection_acceptor.hpp"
 
+#include "caf/net/multiplexer.hpp"
+#include "caf/net/socket_manager.hpp"
+
+#include "caf/async/execution_context.hpp"
+
 namespace caf::detail {
 
 connection_acceptor::~connection_acceptor() {
   // nop
 }
 
+action connection_acceptor::make_close_listener(net::socket_manager* parent,
+                                                const action& on_conn_close) {
+  auto ctx = async::execution_context_ptr{parent->mpx_ptr(), add_ref};
+  return make_single_shot_action([ctx, cb = on_conn_close] {
+    if (!cb.disposed())
+      ctx->schedule(cb);
+  });
+}
+
 } // namespace caf::detail
@@ -24,7 +24,8 @@ public:
   /// Callback from the socket manager for startup.
   /// @param parent The socket manager that owns this acceptor.
   /// @param on_conn_close Callback to invoke when a connection is fully closed
-  ///        (socket cleaned up AND all outstanding requests destroyed).
+  ///        (socket cleaned up AND all outstanding requests destroyed). Must
+  ///        be wrapped with `make_close_listener` for each connection.
   virtual error start(net::socket_manager* parent, action on_conn_close) = 0;
 
   /// Aborts the acceptor.
@@ -35,6 +36,14 @@ public:
 
   /// Returns the socket handle of the acceptor.
   virtual net::socket handle() const = 0;
+
+protected:
+  /// Creates a single-shot action for a single connection that schedules
+  /// `on_conn_close` on the multiplexer of `parent`. Connections may run on
+  /// other multiplexers than their acceptor, so they must not run
+  /// `on_conn_close` directly.
+  static action make_close_listener(net::socket_manager* parent,
+                                    const action& on_conn_close);
 };
 
 using connection_acceptor_ptr = std::unique_ptr<connection_acceptor>;
@@ -9,21 +9,147 @@
 #include <cstring>
 #include <limits>
 
+#if defined(__SSE2__) || defined(_M_X64)
+#  define CAF_RFC6455_SSE2
+#  include <emmintrin.h>
+#endif
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#  define CAF_RFC6455_AVX2
+#  include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON)
+#  define CAF_RFC6455_NEON
+#  include <arm_neon.h>
+#endif
+
 namespace caf::detail {
 
+namespace {
+
+// All masking functions receive the key rotated to the first byte of the
+// payload. Each function masks a prefix of the payload that is a multiple of
+// its block size and returns the size of that prefix. Since block sizes are
+// multiples of four, the rotated key also applies to the remaining bytes.
+
+/// Repeats the four bytes of `key` until filling `out`.
+template <size_t N>
+void fill_pattern(const std::byte* key, std::byte (&out)[N]) {
+  static_assert(N % 4 == 0);
+  for (size_t i = 0; i < N; ++i)
+    out[i] = key[i % 4];
+}
+
+/// Masks the payload in blocks of eight bytes.
+size_t mask_words(const std::byte* key, std::byte* first, size_t len) {
+  std::byte buf[8];
+  fill_pattern(key, buf);
+  uint64_t pattern;
+  memcpy(&pattern, buf, 8);
+  size_t i = 0;
+  for (; i + 8 <= len; i += 8) {
+    uint64_t word;
+    memcpy(&word, first + i, 8);
+    word ^= pattern;
+    memcpy(first + i, &word, 8);
+  }
+  return i;
+}
+
+#ifdef CAF_RFC6455_SSE2
+
+/// Masks the payload in blocks of 16 bytes.
+size_t mask_sse2(const std::byte* key, std::byte* first, size_t len) {
+  std::byte buf[16];
+  fill_pattern(key, buf);
+  auto pattern = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buf));
+  size_t i = 0;
+  for (; i + 16 <= len; i += 16) {
+    auto* ptr = reinterpret_cast<__m128i*>(first + i);
+    _mm_storeu_si128(ptr, _mm_xor_si128(_mm_loadu_si128(ptr), pattern));
+  }
+  return i;
+}
+
+#endif // CAF_RFC6455_SSE2
+
+#ifdef CAF_RFC6455_AVX2
+
+/// Masks the payload in blocks of 32 bytes.
+__attribute__((target("avx2"))) size_t
+mask_avx2(const std::byte* key, std::byte* first, size_t len) {
+  std::byte buf[32];
+  fill_pattern(key, buf);
+  auto pattern = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(buf));
+  size_t i = 0;
+  for (; i + 32 <= len; i += 32) {
+    auto* ptr = reinterpret_cast<__m256i*>(first + i);
+    _mm256_storeu_si256(ptr,
+                        _mm256_xor_si256(_mm256_loadu_si256(ptr), pattern));
+  }
+  return i;
+}
+
+#endif // CAF_RFC6455_AVX2
+
+#ifdef CAF_RFC6455_NEON
+
+/// Masks the payload in blocks of 16 bytes.
+size_t mask_neon(const std::byte* key, std::byte* first, size_t len) {
+  std::byte buf[16];
+  fill_pattern(key, buf);
+  auto pattern = vld1q_u8(reinterpret_cast<const uint8_t*>(buf));
+  size_t i = 0;
+  for (; i + 16 <= len; i += 16) {
+    auto* ptr = reinterpret_cast<uint8_t*>(first + i);
+    vst1q_u8(ptr, veorq_u8(vld1q_u8(ptr), pattern));
+  }
+  return i;
+}
+
+#endif // CAF_RFC6455_NEON
+
+using mask_fn = size_t (*)(const std::byte*, std::byte*, size_t);
+
+/// Picks the widest implementation that the CPU supports.
+mask_fn select_mask_fn() {
+#if defined(CAF_RFC6455_AVX2)
+  if (__builtin_cpu_supports("avx2"))
+    return mask_avx2;
+#endif
+#if defined(CAF_RFC6455_SSE2)
+  return mask_sse2;
+#elif defined(CAF_RFC6455_NEON)
+  return mask_neon;
+#else
+  return mask_words;
+#endif
+}
+
+} // namespace
+
 void rfc6455::mask_data(uint32_t key, std::span<char> data, size_t offset) {
   mask_data(key, as_writable_bytes(data), offset);
 }
 
 void rfc6455::mask_data(uint32_t key, byte_span data, size_t offset) {
+  if (offset >= data.size())
+    return;
   auto no_key = to_network_order(key);
   std::byte arr[4];
   memcpy(arr, &no_key, 4);
-  auto i = offset % 4;
-  for (auto it = data.begin() + offset; it < data.end(); ++it) {
-    *it ^= arr[i];
-    i = (i + 1) % 4;
-  }
+  // Rotate the key to start at the first byte we mask.
+  std::byte rotated[4];
+  for (size_t i = 0; i < 4; ++i)
+    rotated[i] = arr[(offset + i) % 4];
+  auto* first = data.data() + offset;
+  auto len = data.size() - offset;
+  static const auto vectorized = select_mask_fn();
+  auto done = vectorized(rotated, first, len);
+  done += mask_words(rotated, first + done, len - done);
+  for (auto i = done; i < len; ++i)
+    first[i] ^= rotated[i % 4];
 }
 
 void rfc6455::assemble_frame(uint32_t mask_key, std::span<const char> data,
@@ -39,15 +165,23 @@ void rfc6455::assemble_frame(uint32_t mask_key, const_byte_span data,
 void rfc6455::assemble_frame(uint8_t opcode, uint32_t mask_key,
                              const_byte_span data, byte_buffer& out,
                              uint8_t flags) {
+  assemble_header(opcode, mask_key, data.size(), out, flags);
+  // Application data.
+  out.insert(out.end(), data.begin(), data.end());
+}
+
+void rfc6455::assemble_header(uint8_t opcode, uint32_t mask_key,
+                              size_t payload_size, byte_buffer& out,
+                              uint8_t flags) {
   // First 8 bits: flags + opcode
   out.push_back(static_cast<std::byte>(flags | static_cast<uint8_t>(opcode)));
   // Mask flag + payload length (7 bits, 7+16 bits, or 7+64 bits)
   auto mask_bit = std::byte{static_cast<uint8_t>(mask_key == 0 ? 0x00 : 0x80)};
-  if (data.size() < 126) {
-    auto len = static_cast<uint8_t>(data.size());
+  if (payload_size < 126) {
+    auto len = static_cast<uint8_t>(payload_size);
     out.push_back(mask_bit | std::byte{len});
-  } else if (data.size() <= std::numeric_limits<uint16_t>::max()) {
-    auto len = static_cast<uint16_t>(data.size());
+  } else if (payload_size <= std::numeric_limits<uint16_t>::max()) {
+    auto len = static_cast<uint16_t>(payload_size);
     auto no_len = to_network_order(len);
     std::byte len_data[2];
     memcpy(len_data, &no_len, 2);
@@ -55,7 +189,7 @@ void rfc6455::assemble_frame(uint8_t opcode, uint32_t mask_key,
     for (auto x : len_data)
       out.push_back(x);
   } else {
-    auto len = static_cast<uint64_t>(data.size());
+    auto len = static_cast<uint64_t>(payload_size);
     auto no_len = to_network_order(len);
     std::byte len_data[8];
     memcpy(len_data, &no_len, 8);
@@ -69,8 +203,6 @@ void rfc6455::assemble_frame(uint8_t opcode, uint32_t mask_key,
     memcpy(key_data, &no_key, 4);
     out.insert(out.end(), key_data, key_data + 4);
   }
-  // Application data.
-  out.insert(out.end(), data.begin(), data.end());
 }
 
 ptrdiff_t rfc6455::decode_header(const_byte_span data, header& result) {
@@ -8,6 +8,7 @@
 
 #include "caf/byte_buffer.hpp"
 
+#include <algorithm>
 #include <cstdint>
 #include <initializer_list>
 #include <span>
@@ -32,6 +33,18 @@ auto take(const T& xs, size_t num_bytes) {
   return std::vector<typename T::value_type>{xs.begin(), xs.begin() + n};
 }
 
+/// Masks one byte at a time for comparing the results of `mask_data`.
+void mask_bytewise(uint32_t key, byte_span data, size_t offset) {
+  std::byte arr[4] = {
+    static_cast<std::byte>(key >> 24),
+    static_cast<std::byte>(key >> 16),
+    static_cast<std::byte>(key >> 8),
+    static_cast<std::byte>(key),
+  };
+  for (auto i = offset; i < data.size(); ++i)
+    data[i] ^= arr[i % 4];
+}
+
 } // namespace
 
 TEST("masking the full payload") {
@@ -71,6 +84,24 @@ TEST("partial masking with offset") {
   }
 }
 
+TEST("masking large payloads is equivalent to masking each byte") {
+  auto key = uint32_t{0xDEADC0DE};
+  byte_buffer data;
+  for (size_t i = 0; i < 200; ++i)
+    data.push_back(static_cast<std::byte>(i * 7));
+  // Cover all combinations of block sizes, tails and unaligned offsets.
+  for (size_t size = 0; size <= data.size(); ++size) {
+    for (size_t offset = 0; offset <= std::min(size, size_t{40}); ++offset) {
+      auto uut = byte_buffer{data.begin(), data.begin() + size};
+      auto expected = uut;
+      impl::mask_data(key, uut, offset);
+      mask_bytewise(key, expected, offset);
+      if (uut != expected)
+        fail("mask_data failed for size {} and offset {}", size, offset);
+    }
+  }
+}
+
 TEST("decoding a frame with RSV bits fails") {
   std::vector<uint8_t> data;
   byte_buffer out = bytes({
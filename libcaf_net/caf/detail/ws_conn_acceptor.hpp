@@ -12,8 +12,11 @@
 #include "caf/detail/net_export.hpp"
 #include "caf/expected.hpp"
 #include "caf/intrusive_ptr.hpp"
+#include "caf/make_counted.hpp"
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <utility>
 
 namespace caf::detail {
@@ -43,6 +46,50 @@ public:
 
 using ws_conn_acceptor_ptr = intrusive_ptr<ws_conn_acceptor>;
 
+/// Serializes access to a blocking producer that multiple multiplexers share.
+/// Connections of a WebSocket server may run on different multiplexers, e.g.,
+/// when opening multiple listeners with `SO_REUSEPORT`.
+template <class T>
+class ws_shared_producer {
+public:
+  using impl_type = typename async::blocking_producer<T>::impl;
+
+  explicit ws_shared_producer(async::spsc_buffer_ptr<T> buf)
+    : impl_(make_counted<impl_type>(std::move(buf))) {
+    // nop
+  }
+
+  ~ws_shared_producer() {
+    impl_->close();
+  }
+
+  bool push(const T& item) {
+    std::lock_guard guard{mtx_};
+    return !aborted_.load(std::memory_order_relaxed) && impl_->push(item);
+  }
+
+  bool canceled() const noexcept {
+    return aborted_.load(std::memory_order_acquire) || impl_->canceled();
+  }
+
+  void abort(const error& reason) {
+    std::lock_guard guard{mtx_};
+    aborted_.store(true, std::memory_order_release);
+    impl_->abort(reason);
+  }
+
+private:
+  /// Serializes calls to `push` and `abort`.
+  std::mutex mtx_;
+
+  /// Allows `canceled` to check for `abort` without locking.
+  std::atomic<bool> aborted_ = false;
+
+  /// Points to the producer. Unlike `blocking_producer`, we never reset this
+  /// pointer, so `canceled` may access it concurrently.
+  intrusive_ptr<impl_type> impl_;
+};
+
 template <class... Ts>
 class ws_conn_starter_impl : public ws_conn_starter {
 public:
@@ -52,11 +99,9 @@ public:
     = cow_tuple<async::consumer_resource<net::web_socket::frame>,
                 async::producer_resource<net::web_socket::frame>, Ts...>;
 
-  using producer_type = async::blocking_producer<accept_event>;
+  using producer_type = ws_shared_producer<accept_event>;
 
-  // Note: this is shared with the connection factory. In general, this is
-  //       *unsafe*. However, we exploit the fact that there is currently only
-  //       one thread running in the multiplexer (which makes this safe).
+  // Note: this is shared with the connection factory.
   using shared_producer_type = std::shared_ptr<producer_type>;
 
   /// The pair of resources for the WebSocket worker.
@@ -92,7 +137,7 @@ public:
     = cow_tuple<async::consumer_resource<net::web_socket::frame>,
                 async::producer_resource<net::web_socket::frame>, Ts...>;
 
-  using producer_type = async::blocking_producer<accept_event>;
+  using producer_type = ws_shared_producer<accept_event>;
 
   using shared_producer_type = std::shared_ptr<producer_type>;
 
@@ -104,7 +149,9 @@ public:
 
   expected<ws_conn_starter_ptr> accept(const net::http::request_header& hdr,
                                        net::socket_manager* mgr) override {
-    if (!producer_) {
+    // Connections on different multiplexers may call this concurrently.
+    std::lock_guard guard{mtx_};
+    if (producer_->canceled()) {
       return expected<ws_conn_starter_ptr>{
         unexpect, sec::runtime_error,
         "WebSocket connection dropped: client canceled"};
@@ -126,17 +173,17 @@ public:
   }
 
   bool canceled() const noexcept override {
-    return !producer_ || producer_->canceled();
+    return producer_->canceled();
   }
 
   void abort(const error& reason) override {
-    if (producer_) {
-      producer_->abort(reason);
-      producer_ = nullptr;
-    }
+    producer_->abort(reason);
   }
 
 private:
+  /// Serializes calls to `on_request_`.
+  std::mutex mtx_;
+
   OnRequest on_request_;
   shared_producer_type producer_;
 };
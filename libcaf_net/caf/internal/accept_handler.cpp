@@ -50,6 +50,9 @@ public:
       }
     }
     on_conn_close_ = make_action([this] { connection_closed(); });
+    // Connections may run on a different multiplexer. Hence, the acceptor
+    // gives each connection a single-shot action that moves the callback back
+    // to our multiplexer.
     if (auto err = acceptor_->start(owner, on_conn_close_); err.valid()) {
       log::net::debug("failed to start the acceptor: {}", err);
       return err;
@@ -85,8 +88,14 @@ public:
       // when the connection is fully closed. For most protocols, this happens
       // when the socket manager cleans up. For HTTP, this also requires all
       // outstanding http::request objects to be destroyed.
-      if (auto err = child->start(); err.valid()) {
-        on_error(err);
+      if (child->mpx_ptr() == owner_->mpx_ptr()) {
+        if (auto err = child->start(); err.valid())
+          on_error(err);
+      } else if (!child->mpx().start(child)) {
+        log::net::debug("failed to start a connection on socket {}: "
+                        "multiplexer is shutting down",
+                        child->handle().id);
+        on_error(sec::runtime_error);
       }
     } else if (conn.error() == sec::unavailable_or_would_block) {
       // Encountered a "soft" error: simply try again later.
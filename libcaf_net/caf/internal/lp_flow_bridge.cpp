@@ -31,11 +31,7 @@ public:
   using super::super;
 
   bool write(const net::lp::frame& item) override {
-    super::down_->begin_message();
-    auto& bytes = super::down_->message_buffer();
-    auto src = item.bytes();
-    bytes.insert(bytes.end(), src.begin(), src.end());
-    return super::down_->end_message();
+    return super::down_->send_message(item);
   }
 
   // -- implementation of lp::lower_layer --------------------------------------
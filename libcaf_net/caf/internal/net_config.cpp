@@ -4,10 +4,66 @@
 
 #include "caf/internal/net_config.hpp"
 
+#include "caf/net/multiplexer.hpp"
+#include "caf/net/network_socket.hpp"
+
+#include <vector>
+
 namespace caf::internal {
 
 net_config::~net_config() {
   // nop
 }
 
+expected<disposable>
+net_config::start_reuse_port_server(server_config::lazy& cfg) {
+  // Open all sockets before starting any acceptor to fail early.
+  std::vector<net::tcp_accept_socket> fds;
+  auto close_from = [&fds](size_t first) {
+    for (auto i = first; i < fds.size(); ++i)
+      net::close(fds[i]);
+  };
+  uri::authority_type auth;
+  auth.host = std::move(cfg.bind_address);
+  auth.port = cfg.port;
+  for (size_t i = 0; i < cfg.num_listeners; ++i) {
+    auto fd = net::make_tcp_accept_socket(auth, cfg.reuse_addr, true);
+    if (!fd) {
+      close_from(0);
+      return expected<disposable>{unexpect, std::move(fd.error())};
+    }
+    fds.push_back(*fd);
+    // All other sockets must bind to the port that the OS picked.
+    if (auth.port == 0) {
+      auto port = net::local_port(*fd);
+      if (!port) {
+        close_from(0);
+        return expected<disposable>{unexpect, std::move(port.error())};
+      }
+      auth.port = *port;
+    }
+  }
+  // Start one acceptor per socket, spreading them across the multiplexers.
+  auto* parent = mpx;
+  std::vector<disposable> servers;
+  servers.reserve(fds.size());
+  for (size_t i = 0; i < fds.size(); ++i) {
+    mpx = i == 0 ? parent : parent->select_shard();
+    server_config::socket sub_cfg{fds[i]};
+    auto res = start_server(sub_cfg);
+    if (!res) {
+      mpx = parent;
+      for (auto& hdl : servers)
+        hdl.dispose();
+      close_from(i + 1);
+      return res;
+    }
+    servers.push_back(std::move(*res));
+  }
+  mpx = parent;
+  log::net::debug("started {} acceptors with SO_REUSEPORT on port {}",
+                  servers.size(), auth.port);
+  return expected<disposable>{disposable::make_composite(std::move(servers))};
+}
+
 } // namespace caf::internal
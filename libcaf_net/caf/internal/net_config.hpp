@@ -49,6 +49,10 @@ public:
 
       /// Whether to set `SO_REUSEADDR` on the socket.
       bool reuse_addr = true;
+
+      /// The number of sockets that listen on the same port via
+      /// `SO_REUSEPORT`, each with its own acceptor.
+      size_t num_listeners = 1;
     };
 
     /// Configuration for a server that uses a user-provided socket.
@@ -267,6 +271,8 @@ public:
   }
 
   expected<disposable> start_server(server_config::lazy& cfg) {
+    if (cfg.num_listeners > 1)
+      return start_reuse_port_server(cfg);
     auto maybe_fd = net::make_tcp_accept_socket(cfg.port,
                                                 std::move(cfg.bind_address),
                                                 cfg.reuse_addr);
@@ -277,6 +283,11 @@ public:
     return start_server(sub_cfg);
   }
 
+  /// Opens `cfg.num_listeners` sockets for the same port with `SO_REUSEPORT`
+  /// and starts an acceptor for each socket. Each acceptor runs on the
+  /// multiplexer selected by `mpx->select_shard()`.
+  expected<disposable> start_reuse_port_server(server_config::lazy& cfg);
+
   expected<disposable> start_server() {
     auto fn = [this](auto& val) -> expected<disposable> {
       return start_server(val);
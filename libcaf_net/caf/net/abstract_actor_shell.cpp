@@ -130,9 +130,9 @@ bool abstract_actor_shell::enqueue(mailbox_element_ptr ptr, scheduler*) {
   auto mid = ptr->mid;
   auto sender = ptr->sender;
   auto collects_metrics = getf(abstract_actor::collects_metrics_flag);
-  if (auto* mailbox_size = metrics_.mailbox_size) {
+  if (auto& mailbox_size = metrics_.mailbox_size) {
     ptr->set_enqueue_time();
-    mailbox_size->inc();
+    mailbox_size.inc();
   }
   switch (mailbox().push_back(std::move(ptr))) {
     case intrusive::inbox_result::unblocked_reader: {
@@ -153,8 +153,8 @@ bool abstract_actor_shell::enqueue(mailbox_element_ptr ptr, scheduler*) {
     default: { // intrusive::inbox_result::queue_closed
       CAF_LOG_REJECT_EVENT();
       home_system().message_rejected(this);
-      if (auto* mailbox_size = metrics_.mailbox_size) {
-        mailbox_size->dec();
+      if (auto& mailbox_size = metrics_.mailbox_size) {
+        mailbox_size.dec();
       }
       if (mid.is_request()) {
         detail::sync_request_bouncer f;
@@ -203,7 +203,7 @@ void abstract_actor_shell::close_mailbox(const error& reason) {
   if (!mailbox_.closed()) {
     auto dropped = mailbox_.close(reason);
     if (dropped > 0 && metrics_.mailbox_size)
-      metrics_.mailbox_size->dec(static_cast<int64_t>(dropped));
+      metrics_.mailbox_size.dec(static_cast<int64_t>(dropped));
   }
 }
 
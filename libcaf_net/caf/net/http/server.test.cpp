@@ -91,9 +91,11 @@ public:
   }
 
   error end_chunked_message() override {
+    // Tests may check the side effects of the callback as soon as the promise
+    // holds a value, so the callback must run first.
+    cb(down, current_response);
     if (response)
       response.set_value(current_response);
-    cb(down, current_response);
     current_response.clear();
     return error{};
   }
@@ -116,9 +118,10 @@ public:
                     const_byte_span body) override {
     current_response.hdr = request_hdr;
     current_response.payload.assign(body.begin(), body.end());
+    // Run the callback first (see end_chunked_message).
+    cb(down, current_response);
     if (response)
       response.set_value(current_response);
-    cb(down, current_response);
     current_response.clear();
     return static_cast<ptrdiff_t>(body.size());
   }
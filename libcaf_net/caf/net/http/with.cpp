@@ -18,6 +18,7 @@
 #include "caf/internal/net_config.hpp"
 #include "caf/make_counted.hpp"
 
+#include <algorithm>
 #include <atomic>
 
 namespace caf::net::http {
@@ -142,8 +143,9 @@ public:
                                                std::move(conn.error())};
     // Create the connection guard. The router and each http::request hold a
     // reference. When all references are released, on_conn_close_ fires.
-    auto* mpx = parent_->mpx_ptr();
-    auto guard = make_counted<http_connection_guard>(mpx, on_conn_close_);
+    auto* mpx = parent_->mpx().select_shard();
+    auto guard = make_counted<http_connection_guard>(
+      mpx, make_close_listener(parent_, on_conn_close_));
     // Instantiate our protocol stack.
     auto app = net::http::router::make(routes_, std::move(guard));
     auto serv = net::http::server::make(std::move(app));
@@ -158,7 +160,12 @@ public:
     transport->max_consecutive_reads(max_consecutive_reads_);
     transport->active_policy().accept();
     auto res = net::socket_manager::make(mpx, std::move(transport));
-    mpx->watch(res->as_disposable());
+    if (mpx == parent_->mpx_ptr())
+      mpx->watch(res->as_disposable());
+    else
+      mpx->schedule_fn([mpx, hdl = res->as_disposable()]() mutable {
+        mpx->watch(std::move(hdl));
+      });
     return res;
   }
 
@@ -208,8 +215,8 @@ public:
 
   using super::super;
 
-  template <class Acceptor>
-  expected<disposable> do_start_server(Acceptor& acc) {
+  /// Adds the route for `push` if present and initializes all routes.
+  error init_routes() {
     if (push) {
       auto producer = make_http_request_producer({mpx, add_ref},
                                                  push.try_open());
@@ -219,17 +226,27 @@ public:
           res.router()->abort_and_shutdown(err);
         }
       });
-      if (!new_route) {
-        return expected<disposable>{unexpect, std::move(new_route.error())};
-      }
+      if (!new_route)
+        return std::move(new_route.error());
       routes.push_back(std::move(*new_route));
     } else if (routes.empty()) {
-      return expected<disposable>{
-        unexpect, sec::logic_error,
-        "cannot start an HTTP server without any routes"};
+      return make_error(sec::logic_error,
+                        "cannot start an HTTP server without any routes");
     }
     for (auto& ptr : routes)
       ptr->init();
+    return {};
+  }
+
+  template <class Acceptor>
+  expected<disposable> do_start_server(Acceptor& acc) {
+    // Servers with multiple listeners call this function once per listener
+    // but share the routes.
+    if (!routes_initialized) {
+      if (auto err = init_routes(); err.valid())
+        return expected<disposable>{unexpect, std::move(err)};
+      routes_initialized = true;
+    }
     auto factory = make_http_conn_acceptor(std::move(acc), routes,
                                            max_consecutive_reads,
                                            max_request_size);
@@ -320,6 +337,9 @@ public:
   /// Stores the producer resource for `do_start_server`.
   push_t push;
 
+  /// Stores whether `init_routes` has been called.
+  bool routes_initialized = false;
+
   // State for clients.
 
   /// Store HTTP method for the request.
@@ -368,6 +388,13 @@ with_t::server&& with_t::server::reuse_address(bool value) && {
   return std::move(*this);
 }
 
+with_t::server&& with_t::server::reuse_port(size_t num_listeners) && {
+  if (auto* lazy = std::get_if<internal::net_config::server_config::lazy>(
+        &config_->server.value))
+    lazy->num_listeners = std::max(num_listeners, size_t{1});
+  return std::move(*this);
+}
+
 void with_t::server::do_monitor(strong_actor_ptr ptr) {
   config_->do_monitor(std::move(ptr));
 }
@@ -465,7 +492,7 @@ with_t with(multiplexer* mpx) {
 }
 
 with_t with(actor_system& sys) {
-  return with(multiplexer::from(sys));
+  return with(multiplexer::from(sys)->select_shard());
 }
 
 with_t::with_t(multiplexer* mpx) : config_(new config_impl(mpx)) {
@@ -333,3 +333,52 @@ TEST("GH-2226 regression") {
   hdl->dispose();
   check_eq(elog->errors(), std::vector<error>{});
 }
+
+#ifndef CAF_WINDOWS
+
+TEST("servers may open multiple listeners with SO_REUSEPORT") {
+  // Setup.
+  caf::actor_system_config cfg;
+  cfg.set("caf.net.multiplexer-shards", 2);
+  cfg.load<caf::net::middleman>();
+  caf::actor_system sys{cfg};
+  // Pick a port by opening a socket that we close after starting the server.
+  uri::authority_type auth;
+  auth.host = "127.0.0.1"s;
+  auth.port = 0;
+  auto probe = unbox(net::make_tcp_accept_socket(auth, true, true));
+  auto port = unbox(net::local_port(probe));
+  // Launch our server with two listeners.
+  auto hdl = net::http::with(sys)
+               .accept(port, "127.0.0.1")
+               .reuse_port(2)
+               .route("/status", net::http::method::get,
+                      [](net::http::responder& res) {
+                        res.respond(net::http::status::no_content);
+                      })
+               .start();
+  net::close(probe);
+  require_has_value(hdl);
+  detail::scope_guard hdl_guard{[hdl]() mutable noexcept { hdl->dispose(); }};
+  // The OS distributes the connections to both listeners. Each request must
+  // receive a response, regardless of the listener that accepts it.
+  for (int i = 0; i < 8; ++i) {
+    auto fd = unbox(net::make_connected_tcp_stream_socket("127.0.0.1", port,
+                                                          1s));
+    net::socket_guard guard{fd};
+    auto request = detail::format("GET /status HTTP/1.1\r\n"
+                                  "Host: localhost:{}\r\n\r\n",
+                                  port);
+    require_eq(net::write(fd, as_bytes(std::span{request})),
+               static_cast<ptrdiff_t>(request.size()));
+    require_eq(net::receive_timeout(fd, 1s), error{});
+    byte_buffer buf;
+    buf.resize(12);
+    require_eq(net::read(fd, buf), 12);
+    auto str = std::string_view{reinterpret_cast<const char*>(buf.data()),
+                                buf.size()};
+    check_eq(str, "HTTP/1.1 204");
+  }
+}
+
+#endif // CAF_WINDOWS
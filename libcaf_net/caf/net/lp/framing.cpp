@@ -8,6 +8,7 @@
 
 #include "caf/async/spsc_buffer.hpp"
 #include "caf/byte_span.hpp"
+#include "caf/chunk.hpp"
 #include "caf/detail/assert.hpp"
 #include "caf/detail/network_order.hpp"
 #include "caf/error.hpp"
@@ -18,6 +19,7 @@
 
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <memory>
 
 namespace caf::net::lp {
@@ -155,6 +157,22 @@ public:
     return false;
   }
 
+  bool send_message(const chunk& payload) override {
+    switch (size_field_) {
+      case lp::size_field_type::u1:
+        return send_message_impl<uint8_t>(payload);
+      case lp::size_field_type::u2:
+        return send_message_impl<uint16_t>(payload);
+      case lp::size_field_type::u4:
+        return send_message_impl<uint32_t>(payload);
+      case lp::size_field_type::u8:
+        return send_message_impl<uint64_t>(payload);
+    }
+    log::net::error("invalid size field type");
+    up_->abort(make_error(sec::logic_error, "invalid size field type"));
+    return false;
+  }
+
   void shutdown() override {
     down_->shutdown();
   }
@@ -233,6 +251,29 @@ private:
     return true;
   }
 
+  template <class T>
+  bool send_message_impl(const chunk& payload) {
+    using detail::to_network_order;
+    auto msg_size = payload.size();
+    if (msg_size > max_message_size_
+        || msg_size > static_cast<size_t>(std::numeric_limits<T>::max())) {
+      log::net::debug("maximum message size exceeded");
+      return false;
+    }
+    auto hdr_size_field = T{0};
+    if constexpr (std::is_same_v<T, uint8_t>)
+      hdr_size_field = static_cast<uint8_t>(msg_size);
+    else
+      hdr_size_field = to_network_order(static_cast<T>(msg_size));
+    down_->begin_output();
+    auto& buf = down_->output_buffer();
+    auto hdr_bytes = reinterpret_cast<const std::byte*>(&hdr_size_field);
+    buf.insert(buf.end(), hdr_bytes, hdr_bytes + hdr_size_);
+    // Pass the payload as-is to allow the transport to send it without copying.
+    down_->enqueue_output(payload);
+    return down_->end_output();
+  }
+
   // -- member variables -------------------------------------------------------
 
   octet_stream::lower_layer* down_;
@@ -40,6 +40,14 @@ public:
   /// @note When returning `false`, clients must also call
   ///       `down.set_read_error(...)` with an appropriate error code.
   virtual bool end_message() = 0;
+
+  /// Sends `payload` as a single message. Unlike assembling the message via
+  /// `message_buffer()`, this allows lower layers to send the payload without
+  /// copying it. The default implementation copies `payload` to the message
+  /// buffer.
+  /// @note When returning `false`, clients must also call
+  ///       `down.set_read_error(...)` with an appropriate error code.
+  virtual bool send_message(const chunk& payload);
 };
 
 } // namespace caf::net::lp
@@ -81,9 +81,9 @@ public:
                                               std::move(impl));
     transport->max_consecutive_reads(max_consecutive_reads_);
     transport->active_policy().accept();
-    auto res = net::socket_manager::make(parent_->mpx_ptr(),
+    auto res = net::socket_manager::make(parent_->mpx().select_shard(),
                                          std::move(transport));
-    res->add_cleanup_listener(on_conn_close_);
+    res->add_cleanup_listener(make_close_listener(parent_, on_conn_close_));
     return res;
   }
 
@@ -268,7 +268,7 @@ with_t with(multiplexer* mpx) {
 }
 
 with_t with(actor_system& sys) {
-  return with(multiplexer::from(sys));
+  return with(multiplexer::from(sys)->select_shard());
 }
 
 with_t::with_t(multiplexer* mpx) : config_(new config_impl(mpx)) {
@@ -10,6 +10,7 @@
 #include "caf/net/this_host.hpp"
 
 #include "caf/actor_system_config.hpp"
+#include "caf/defaults.hpp"
 #include "caf/expected.hpp"
 #include "caf/log/net.hpp"
 #include "caf/log/system.hpp"
@@ -17,6 +18,8 @@
 #include "caf/thread_owner.hpp"
 #include "caf/version.hpp"
 
+#include <algorithm>
+
 namespace caf::net {
 
 namespace {
@@ -103,7 +106,21 @@ actor_system::global_state_guard middleman::init_host_system() {
 
 middleman::middleman(actor_system& sys)
   : sys_(sys), mpx_(multiplexer::make(this)) {
-  // nop
+  auto& cfg = sys.config();
+  auto num_shards = get_or(cfg, "caf.net.multiplexer-shards",
+                           defaults::net::multiplexer_shards);
+  shards_.reserve(std::max(num_shards, size_t{1}));
+  shards_.emplace_back(mpx_);
+  for (size_t index = 1; index < num_shards; ++index)
+    shards_.emplace_back(multiplexer::make(this));
+  auto policy = get_or(cfg, "caf.net.shard-policy",
+                       defaults::net::shard_policy);
+  if (policy == "least-loaded")
+    least_loaded_ = true;
+  else if (policy != "round-robin")
+    log::net::warning("unrecognized shard policy {}, falling back to "
+                      "round-robin",
+                      policy);
 }
 
 middleman::~middleman() {
@@ -111,27 +128,56 @@ middleman::~middleman() {
 }
 
 void middleman::start() {
-  auto fn = [this] {
-    mpx_->set_thread_id();
-    mpx_->run();
-  };
-  mpx_thread_ = sys_.launch_thread("caf.net.mpx", thread_owner::system, fn);
+  mpx_threads_.reserve(shards_.size());
+  for (auto& shard : shards_) {
+    auto fn = [mpx = shard] {
+      mpx->set_thread_id();
+      mpx->run();
+    };
+    mpx_threads_.emplace_back(
+      sys_.launch_thread("caf.net.mpx", thread_owner::system, fn));
+  }
   launch_background_tasks(sys_);
 }
 
 void middleman::stop() {
-  mpx_->shutdown();
-  if (mpx_thread_.joinable())
-    mpx_thread_.join();
-  else
-    mpx_->run();
+  for (auto& shard : shards_)
+    shard->shutdown();
+  for (size_t index = 0; index < shards_.size(); ++index) {
+    if (index < mpx_threads_.size() && mpx_threads_[index].joinable())
+      mpx_threads_[index].join();
+    else
+      shards_[index]->run();
+  }
+  mpx_threads_.clear();
 }
 
 void middleman::init(actor_system_config&) {
-  if (auto err = mpx_->init(); err.valid()) {
-    log::system::error("failed to initialize multiplexer: {}", err);
-    CAF_RAISE_ERROR("mpx_->init() failed");
+  for (auto& shard : shards_) {
+    if (auto err = shard->init(); err.valid()) {
+      log::system::error("failed to initialize multiplexer: {}", err);
+      CAF_RAISE_ERROR("mpx_->init() failed");
+    }
+  }
+}
+
+multiplexer* middleman::select_mpx() noexcept {
+  if (shards_.size() == 1)
+    return mpx_.get();
+  if (least_loaded_) {
+    auto* result = shards_.front().get();
+    auto load = result->num_socket_managers_hint();
+    for (size_t index = 1; index < shards_.size(); ++index) {
+      auto* ptr = shards_[index].get();
+      if (auto n = ptr->num_socket_managers_hint(); n < load) {
+        result = ptr;
+        load = n;
+      }
+    }
+    return result;
   }
+  auto index = next_shard_.fetch_add(1, std::memory_order_relaxed);
+  return shards_[index % shards_.size()].get();
 }
 
 middleman::actor_system_module::id_t middleman::id() const {
@@ -143,6 +189,12 @@ void* middleman::subtype_ptr() {
 }
 
 void middleman::add_module_options(actor_system_config& cfg) {
+  config_option_adder{cfg.custom_options(), "caf.net"}.add<std::string>(
+    "multiplexer", "'poll' (default) or 'epoll' (Linux only)")
+    .add<size_t>("multiplexer-shards",
+                 "number of multiplexers, each running in its own thread")
+    .add<std::string>("shard-policy",
+                      "'round-robin' (default) or 'least-loaded'");
   config_option_adder{cfg.custom_options(), "caf.net.prometheus-http"}
     .add<uint16_t>("port", "listening port for incoming scrapes")
     .add<std::string>("address", "bind address for the HTTP server socket")
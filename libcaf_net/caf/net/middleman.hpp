@@ -14,7 +14,9 @@
 #include "caf/type_list.hpp"
 #include "caf/version.hpp"
 
+#include <atomic>
 #include <thread>
+#include <vector>
 
 namespace caf::net {
 
@@ -91,6 +93,25 @@ public:
     return mpx_.get();
   }
 
+  /// Returns the number of multiplexers, i.e., the number of I/O threads, as
+  /// configured by `caf.net.multiplexer-shards`.
+  size_t num_mpx() const noexcept {
+    return shards_.size();
+  }
+
+  /// Returns the multiplexer at position `index`. The multiplexer at position
+  /// 0 is the same as `mpx()`.
+  /// @pre `index < num_mpx()`
+  multiplexer& mpx(size_t index) noexcept {
+    return *shards_[index];
+  }
+
+  /// Selects a multiplexer for running a new socket manager according to
+  /// `caf.net.shard-policy`. Always returns `mpx_ptr()` when running a single
+  /// multiplexer.
+  /// @threadsafe
+  multiplexer* select_mpx() noexcept;
+
 private:
   // -- member variables -------------------------------------------------------
 
@@ -100,8 +121,18 @@ private:
   /// Stores the global socket I/O multiplexer.
   multiplexer_ptr mpx_;
 
-  /// Runs the multiplexer's event loop
-  std::thread mpx_thread_;
+  /// Stores all multiplexers, starting with `mpx_`.
+  std::vector<multiplexer_ptr> shards_;
+
+  /// Runs the event loops of the multiplexers, one thread per shard.
+  std::vector<std::thread> mpx_threads_;
+
+  /// Selects the multiplexer with the fewest socket managers instead of
+  /// cycling through all multiplexers.
+  bool least_loaded_ = false;
+
+  /// Position of the next multiplexer for the round-robin policy.
+  std::atomic<size_t> next_shard_ = 0;
 };
 
 } // namespace caf::net
@@ -0,0 +1,183 @@
+// This file is part of CAF, the C++ Actor Framework. See the file LICENSE in
+// the main distribution directory for license terms and copyright or visit
+// https://github.com/actor-framework/actor-framework/blob/main/LICENSE.
+
+#include "caf/net/middleman.hpp"
+
+#include "caf/test/test.hpp"
+
+#include "caf/net/multiplexer.hpp"
+#include "caf/net/network_socket.hpp"
+#include "caf/net/octet_stream/with.hpp"
+#include "caf/net/socket_guard.hpp"
+#include "caf/net/stream_socket.hpp"
+#include "caf/net/tcp_accept_socket.hpp"
+#include "caf/net/tcp_stream_socket.hpp"
+
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/event_based_actor.hpp"
+#include "caf/flow/observable.hpp"
+#include "caf/flow/observable_builder.hpp"
+
+#include <chrono>
+#include <map>
+#include <thread>
+#include <vector>
+
+using namespace caf;
+using namespace std::literals;
+
+namespace {
+
+struct config : actor_system_config {
+  explicit config(size_t num_shards, std::string_view policy = "round-robin") {
+    load<net::middleman>();
+    set("caf.scheduler.max-threads", 2);
+    set("caf.net.multiplexer-shards", num_shards);
+    set("caf.net.shard-policy", policy);
+  }
+};
+
+} // namespace
+
+TEST("the middleman runs a single multiplexer by default") {
+  actor_system_config cfg;
+  cfg.load<net::middleman>();
+  actor_system sys{cfg};
+  auto& mm = sys.network_manager();
+  check_eq(mm.num_mpx(), 1u);
+  check_eq(mm.select_mpx(), mm.mpx_ptr());
+  check_eq(mm.mpx().select_shard(), mm.mpx_ptr());
+}
+
+TEST("the round-robin policy cycles through all multiplexers") {
+  config cfg{3};
+  actor_system sys{cfg};
+  auto& mm = sys.network_manager();
+  require_eq(mm.num_mpx(), 3u);
+  check_eq(&mm.mpx(0), mm.mpx_ptr());
+  std::map<net::multiplexer*, size_t> selected;
+  for (size_t i = 0; i < 6; ++i)
+    ++selected[mm.select_mpx()];
+  check_eq(selected.size(), 3u);
+  for (auto& [mpx, count] : selected)
+    check_eq(count, 2u);
+}
+
+TEST("the least-loaded policy selects the multiplexer with fewest managers") {
+  config cfg{2, "least-loaded"};
+  actor_system sys{cfg};
+  auto& mm = sys.network_manager();
+  require_eq(mm.num_mpx(), 2u);
+  // With equal load, the middleman picks the first multiplexer.
+  check_eq(mm.select_mpx(), &mm.mpx(0));
+  // Add a server to the first multiplexer.
+  auto acc = net::make_tcp_accept_socket(0, "127.0.0.1");
+  require(acc.has_value());
+  auto server = net::octet_stream::with(&mm.mpx(0))
+                  .accept(*acc)
+                  .start([](net::acceptor_resource<std::byte>) {});
+  require(server.has_value());
+  auto base_load = mm.mpx(1).num_socket_managers_hint();
+  auto deadline = std::chrono::steady_clock::now() + 5s;
+  while (mm.mpx(0).num_socket_managers_hint() == base_load) {
+    if (std::chrono::steady_clock::now() >= deadline)
+      fail("the server did not start on the first multiplexer");
+    std::this_thread::yield();
+  }
+  check_eq(mm.select_mpx(), &mm.mpx(1));
+  server->dispose();
+}
+
+TEST("servers distribute connections to all multiplexers") {
+  config cfg{2};
+  actor_system sys{cfg};
+  auto& mm = sys.network_manager();
+  require_eq(mm.num_mpx(), 2u);
+  auto acc = net::make_tcp_accept_socket(0, "127.0.0.1");
+  require(acc.has_value());
+  auto port = net::local_port(*acc);
+  require(port.has_value());
+  auto load = [&mm] {
+    return std::vector<size_t>{mm.mpx(0).num_socket_managers_hint(),
+                               mm.mpx(1).num_socket_managers_hint()};
+  };
+  auto base_load = load();
+  // Start an echo server.
+  auto server
+    = net::octet_stream::with(sys)
+        .accept(*acc)
+        .start([&sys](net::acceptor_resource<std::byte> events) {
+          sys.spawn([events](event_based_actor* self) {
+            events.observe_on(self).for_each([self](auto ev) {
+              auto [pull, push] = ev.data();
+              pull.observe_on(self).subscribe(push);
+            });
+          });
+        });
+  require(server.has_value());
+  // Connect four clients and wait for their echo.
+  std::vector<net::socket_guard<net::tcp_stream_socket>> clients;
+  for (int i = 0; i < 4; ++i) {
+    auto conn = net::make_connected_tcp_stream_socket("127.0.0.1", *port);
+    require(conn.has_value());
+    auto buf = std::byte{static_cast<uint8_t>(i)};
+    require_eq(net::write(*conn, std::span{&buf, 1}), 1);
+    buf = std::byte{0xFF};
+    require_eq(net::read(*conn, std::span{&buf, 1}), 1);
+    check_eq(std::to_integer<int>(buf), i);
+    clients.emplace_back(*conn);
+  }
+  // One multiplexer runs the server and each multiplexer must run two of the
+  // four connections.
+  auto final_load = load();
+  check_ge(final_load[0] - base_load[0], 2u);
+  check_ge(final_load[1] - base_load[1], 2u);
+  check_eq(final_load[0] + final_load[1] - base_load[0] - base_load[1], 5u);
+  server->dispose();
+}
+
+TEST("servers resume accepting after concurrent closes at max_connections") {
+  constexpr size_t max_connections = 4;
+  config cfg{4};
+  actor_system sys{cfg};
+  auto acc = net::make_tcp_accept_socket(0, "127.0.0.1");
+  require(acc.has_value());
+  auto port = net::local_port(*acc);
+  require(port.has_value());
+  // Start an echo server that accepts up to four connections.
+  auto server
+    = net::octet_stream::with(sys)
+        .accept(*acc)
+        .max_connections(max_connections)
+        .start([&sys](net::acceptor_resource<std::byte> events) {
+          sys.spawn([events](event_based_actor* self) {
+            events.observe_on(self).for_each([self](auto ev) {
+              auto [pull, push] = ev.data();
+              pull.observe_on(self).subscribe(push);
+            });
+          });
+        });
+  require(server.has_value());
+  // Each round fills up all connection slots and then closes all connections
+  // at once, i.e., multiplexers on different threads report closed
+  // connections concurrently. The server must accept new connections in the
+  // next round. Otherwise, reading the echo runs into a timeout.
+  for (int round = 0; round < 10; ++round) {
+    std::vector<net::socket_guard<net::tcp_stream_socket>> clients;
+    for (size_t i = 0; i < max_connections; ++i) {
+      auto conn = net::make_connected_tcp_stream_socket("127.0.0.1", *port);
+      require(conn.has_value());
+      clients.emplace_back(*conn);
+      require(!net::receive_timeout(*conn, 5s).valid());
+      auto buf = std::byte{static_cast<uint8_t>(i)};
+      require_eq(net::write(*conn, std::span{&buf, 1}), 1);
+      buf = std::byte{0xFF};
+      require_eq(net::read(*conn, std::span{&buf, 1}), 1);
+      check_eq(std::to_integer<size_t>(buf), i);
+    }
+    clients.clear();
+  }
+  server->dispose();
+}
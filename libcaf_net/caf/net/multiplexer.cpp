@@ -13,8 +13,10 @@
 
 #include "caf/action.hpp"
 #include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
 #include "caf/async/execution_context.hpp"
 #include "caf/config.hpp"
+#include "caf/defaults.hpp"
 #include "caf/detail/atomic_ref_counted.hpp"
 #include "caf/detail/critical.hpp"
 #include "caf/detail/latch.hpp"
@@ -22,6 +24,8 @@
 #include "caf/detail/panic.hpp"
 #include "caf/error.hpp"
 #include "caf/expected.hpp"
+#include "caf/format_to_error.hpp"
+#include "caf/format_to_unexpected.hpp"
 #include "caf/log/net.hpp"
 #include "caf/log/system.hpp"
 #include "caf/make_counted.hpp"
@@ -31,6 +35,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <deque>
@@ -39,7 +44,10 @@
 #include <mutex>
 #include <optional>
 #include <span>
+#include <string_view>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 #ifndef CAF_WINDOWS
 #  include <poll.h>
@@ -48,6 +56,12 @@
 #  include "caf/internal/socket_sys_includes.hpp"
 #endif // CAF_WINDOWS
 
+#ifdef CAF_LINUX
+#  include <sys/epoll.h>
+#  include <sys/eventfd.h>
+#  include <unistd.h>
+#endif // CAF_LINUX
+
 namespace caf::net {
 
 namespace {
@@ -79,14 +93,327 @@ const short error_mask = POLLRDHUP | POLLERR | POLLHUP | POLLNVAL;
 
 const short output_mask = POLLOUT;
 
+/// An I/O event that a pollset backend reported for a socket manager.
+struct ready_event {
+  socket_manager_ptr mgr;
+  short events;
+  short revents;
+};
+
+/// Stores the event masks of all registered socket managers and waits for I/O
+/// activity on their sockets.
+class pollset_backend {
+public:
+  virtual ~pollset_backend() = default;
+
+  /// Acquires any system resources that the backend needs.
+  virtual error init() = 0;
+
+  /// Returns the name of the backend for logging purposes.
+  virtual std::string_view name() const noexcept = 0;
+
+  /// Returns the number of registered socket managers.
+  virtual size_t size() const noexcept = 0;
+
+  /// Returns whether `mgr` is currently registered.
+  virtual bool contains(const socket_manager* mgr) const noexcept = 0;
+
+  /// Returns the registered event mask for `mgr` or 0 if `mgr` is not
+  /// registered.
+  virtual short events_of(const socket_manager* mgr) const noexcept = 0;
+
+  /// Adds `mgr` with `events`, changes its event mask or removes it if
+  /// `events` is 0.
+  virtual void update(const socket_manager_ptr& mgr, short events) = 0;
+
+  /// Waits up to `timeout` milliseconds (-1 for no timeout) for I/O events
+  /// and appends them to `out`.
+  /// @returns the number of events, 0 on timeout or -1 on error.
+  virtual int wait(int timeout, std::vector<ready_event>& out) = 0;
+
+  /// Returns all registered socket managers.
+  virtual std::vector<socket_manager_ptr> managers() const = 0;
+};
+
+/// Waits for events with `poll` (or `WSAPoll` on Windows). Each call to `wait`
+/// needs to scan all registered sockets.
+class poll_backend : public pollset_backend {
+public:
+  using pollfd_list = std::vector<pollfd>;
+
+  using manager_list = std::vector<socket_manager_ptr>;
+
+  error init() override {
+    return none;
+  }
+
+  std::string_view name() const noexcept override {
+    return "poll";
+  }
+
+  size_t size() const noexcept override {
+    return managers_.size();
+  }
+
+  bool contains(const socket_manager* mgr) const noexcept override {
+    return index_of(mgr) != -1;
+  }
+
+  short events_of(const socket_manager* mgr) const noexcept override {
+    if (auto index = index_of(mgr); index != -1)
+      return pollset_[index].events;
+    return 0;
+  }
+
+  void update(const socket_manager_ptr& mgr, short events) override {
+    if (auto index = index_of(mgr.get()); index == -1) {
+      if (events != 0) {
+        pollfd new_entry{mgr->handle().id, events, 0};
+        pollset_.emplace_back(new_entry);
+        managers_.emplace_back(mgr);
+      }
+    } else if (events != 0) {
+      pollset_[index].events = events;
+      managers_[index] = mgr;
+    } else {
+      pollset_.erase(pollset_.begin() + index);
+      managers_.erase(managers_.begin() + index);
+    }
+  }
+
+  int wait(int timeout, std::vector<ready_event>& out) override {
+    int presult =
+#ifdef CAF_WINDOWS
+      ::WSAPoll(pollset_.data(), static_cast<ULONG>(pollset_.size()), timeout);
+#else
+      ::poll(pollset_.data(), static_cast<nfds_t>(pollset_.size()), timeout);
+#endif
+    if (presult > 0) {
+      auto remaining = presult;
+      for (size_t i = 0; i < pollset_.size() && remaining > 0; ++i) {
+        if (auto revents = pollset_[i].revents; revents != 0) {
+          out.push_back(ready_event{managers_[i], pollset_[i].events, revents});
+          --remaining;
+        }
+      }
+    }
+    return presult;
+  }
+
+  std::vector<socket_manager_ptr> managers() const override {
+    return managers_;
+  }
+
+private:
+  /// Returns the index of `mgr` in the pollset or `-1`.
+  ptrdiff_t index_of(const socket_manager* mgr) const noexcept {
+    auto first = managers_.begin();
+    auto last = managers_.end();
+    auto i = std::find(first, last, mgr);
+    return i == last ? -1 : std::distance(first, i);
+  }
+
+  /// Bookkeeping data for managed sockets.
+  pollfd_list pollset_;
+
+  /// Maps sockets to their owning managers by storing the managers in the same
+  /// order as their sockets appear in `pollset_`.
+  manager_list managers_;
+};
+
+#ifdef CAF_LINUX
+
+/// Waits for events with `epoll`. The cost of a call to `wait` only depends on
+/// the number of sockets with activity, not on the number of registered
+/// sockets.
+class epoll_backend : public pollset_backend {
+public:
+  /// Maximum number of events per call to `epoll_wait`.
+  static constexpr size_t max_events = 1024;
+
+  ~epoll_backend() override {
+    if (epoll_fd_ != -1)
+      ::close(epoll_fd_);
+  }
+
+  error init() override {
+    epoll_fd_ = ::epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd_ == -1)
+      return format_to_error(sec::network_syscall_failed,
+                             "epoll_create1 failed: {}",
+                             last_socket_error_as_string());
+    events_.resize(max_events);
+    return none;
+  }
+
+  std::string_view name() const noexcept override {
+    return "epoll";
+  }
+
+  size_t size() const noexcept override {
+    return registrations_.size();
+  }
+
+  bool contains(const socket_manager* mgr) const noexcept override {
+    return registrations_.count(mgr) != 0;
+  }
+
+  short events_of(const socket_manager* mgr) const noexcept override {
+    if (auto i = registrations_.find(mgr); i != registrations_.end())
+      return i->second.events;
+    return 0;
+  }
+
+  void update(const socket_manager_ptr& mgr, short events) override {
+    auto i = registrations_.find(mgr.get());
+    if (events == 0) {
+      if (i == registrations_.end())
+        return;
+      // The socket may already be closed, in which case the kernel dropped it
+      // from the epoll set. Hence, errors are expected here. However, we must
+      // not remove the file descriptor if it now belongs to another manager.
+      auto fd = i->second.fd;
+      if (owner_of(fd) == mgr.get()) {
+        ::epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, nullptr);
+        owners_[static_cast<size_t>(fd)] = nullptr;
+      }
+      registrations_.erase(i);
+      return;
+    }
+    if (i != registrations_.end()) {
+      if (i->second.events != events) {
+        auto ev = make_event(i->second.fd, events);
+        if (::epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, i->second.fd, &ev) != 0)
+          log::net::error("failed to modify socket {} in the epoll set: {}",
+                          i->second.fd, last_socket_error_as_string());
+        i->second.events = events;
+      }
+      return;
+    }
+    auto fd = mgr->handle().id;
+    if (fd == invalid_socket_id)
+      return;
+    auto ev = make_event(fd, events);
+    if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &ev) != 0
+        && (errno != EEXIST
+            || ::epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, fd, &ev) != 0)) {
+      log::net::error("failed to add socket {} to the epoll set: {}", fd,
+                      last_socket_error_as_string());
+      return;
+    }
+    // A previous owner of the file descriptor has closed its socket without
+    // removing itself first.
+    if (auto prev = owner_of(fd); prev != nullptr)
+      registrations_.erase(prev);
+    if (static_cast<size_t>(fd) >= owners_.size())
+      owners_.resize(static_cast<size_t>(fd) + 1, nullptr);
+    owners_[static_cast<size_t>(fd)] = mgr.get();
+    registrations_.emplace(mgr.get(), registration{mgr, fd, events});
+  }
+
+  int wait(int timeout, std::vector<ready_event>& out) override {
+    auto presult = ::epoll_wait(epoll_fd_, events_.data(),
+                                static_cast<int>(events_.size()), timeout);
+    if (presult > 0) {
+      auto n = static_cast<size_t>(presult);
+      for (size_t i = 0; i < n; ++i) {
+        auto fd = events_[i].data.fd;
+        if (auto j = registrations_.find(owner_of(fd));
+            j != registrations_.end())
+          out.push_back(ready_event{j->second.mgr, j->second.events,
+                                    to_poll_events(events_[i].events)});
+      }
+    }
+    return presult;
+  }
+
+  std::vector<socket_manager_ptr> managers() const override {
+    std::vector<socket_manager_ptr> result;
+    result.reserve(registrations_.size());
+    for (auto& [key, val] : registrations_)
+      result.emplace_back(val.mgr);
+    return result;
+  }
+
+private:
+  struct registration {
+    socket_manager_ptr mgr;
+    socket_id fd;
+    short events;
+  };
+
+  static epoll_event make_event(socket_id fd, short events) {
+    epoll_event result;
+    memset(&result, 0, sizeof(epoll_event));
+    // Note: we use level-triggered notifications, because socket managers may
+    //       stop reading before draining the socket, e.g., after reaching
+    //       their maximum number of consecutive reads.
+    if ((events & input_mask) != 0)
+      result.events |= EPOLLIN | EPOLLPRI;
+    if ((events & output_mask) != 0)
+      result.events |= EPOLLOUT;
+    result.data.fd = fd;
+    return result;
+  }
+
+  static short to_poll_events(uint32_t events) {
+    short result = 0;
+    if ((events & EPOLLIN) != 0)
+      result |= POLLIN;
+    if ((events & EPOLLPRI) != 0)
+      result |= POLLPRI;
+    if ((events & EPOLLOUT) != 0)
+      result |= POLLOUT;
+    if ((events & EPOLLERR) != 0)
+      result |= POLLERR;
+    if ((events & EPOLLHUP) != 0)
+      result |= POLLHUP;
+    if ((events & EPOLLRDHUP) != 0)
+      result |= POLLRDHUP;
+    return result;
+  }
+
+  const socket_manager* owner_of(socket_id fd) const noexcept {
+    auto index = static_cast<size_t>(fd);
+    return index < owners_.size() ? owners_[index] : nullptr;
+  }
+
+  /// The file descriptor for the epoll set.
+  int epoll_fd_ = -1;
+
+  /// Buffer for `epoll_wait`.
+  std::vector<epoll_event> events_;
+
+  /// Stores the registered managers and their event masks.
+  std::unordered_map<const socket_manager*, registration> registrations_;
+
+  /// Maps file descriptors to their current owner.
+  std::vector<const socket_manager*> owners_;
+};
+
+#endif // CAF_LINUX
+
+/// Creates a handle for waking up the multiplexer. On Linux, we use an eventfd
+/// for both the read and the write handle. Otherwise, we fall back to a pipe.
+expected<std::pair<pipe_socket, pipe_socket>> make_wakeup_handles() {
+#ifdef CAF_LINUX
+  auto fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (fd == -1)
+    return format_to_unexpected(sec::network_syscall_failed,
+                                "eventfd failed: {}",
+                                last_socket_error_as_string());
+  return std::make_pair(pipe_socket{fd}, pipe_socket{fd});
+#else
+  return make_pipe();
+#endif
+}
+
 class pollset_updater : public socket_event_layer {
 public:
   // -- member types -----------------------------------------------------------
 
   using super = socket_manager;
 
-  using msg_buf = std::array<std::byte, sizeof(intptr_t) + 1>;
-
   enum class code : uint8_t {
     start_manager,
     shutdown_reading,
@@ -96,6 +423,12 @@ public:
     shutdown,
   };
 
+  /// An update for the multiplexer from another thread.
+  struct message {
+    code opcode;
+    intptr_t ptr;
+  };
+
   // -- constructors, destructors, and assignment operators --------------------
 
   explicit pollset_updater(pipe_socket fd) : fd_(fd) {
@@ -126,12 +459,18 @@ public:
     // nop
   }
 
+  // -- utility functions ------------------------------------------------------
+
+  /// Releases the pointer in `msg` without processing it.
+  static void discard(const message& msg);
+
 private:
+  void handle(const message& msg);
+
   pipe_socket fd_;
   socket_manager* owner_ = nullptr;
   default_multiplexer* mpx_ = nullptr;
-  msg_buf buf_;
-  size_t buf_size_ = 0;
+  std::vector<message> inbox_;
 };
 
 /// Multiplexes any number of ::socket_manager objects with a ::socket.
@@ -142,40 +481,54 @@ public:
 
   using poll_update_map = unordered_flat_map<socket_manager_ptr, short>;
 
-  using pollfd_list = std::vector<pollfd>;
-
-  using manager_list = std::vector<socket_manager_ptr>;
-
   // -- friends ----------------------------------------------------------------
 
   friend class pollset_updater; // Needs access to the `do_*` functions.
 
   // -- constructors, destructors, and assignment operators --------------------
 
-  explicit default_multiplexer(middleman* parent) : owner_(parent) {
+  default_multiplexer(middleman* parent,
+                      std::unique_ptr<pollset_backend> pollset)
+    : pollset_(std::move(pollset)), owner_(parent) {
     // nop
   }
 
   // -- implementation of caf::net::multiplexer --------------------------------
 
   error init() override {
-    auto pipe_handles = make_pipe();
-    if (!pipe_handles)
-      return std::move(pipe_handles.error());
-    auto updater = pollset_updater::make(pipe_handles->first);
+    if (auto err = pollset_->init(); err.valid())
+      return err;
+    auto handles = make_wakeup_handles();
+    if (!handles)
+      return std::move(handles.error());
+    auto [read_handle, write_handle] = *handles;
+    auto updater = pollset_updater::make(read_handle);
     auto mgr = socket_manager::make(this, std::move(updater));
     if (auto err = mgr->start(); err.valid()) {
-      close(pipe_handles->second);
+      if (write_handle != read_handle)
+        close(write_handle);
       return err;
     }
-    write_handle_ = pipe_handles->second;
-    pollset_.emplace_back(pollfd{pipe_handles->first.id, input_mask, 0});
-    managers_.emplace_back(mgr);
+    write_handle_ = write_handle;
+    shared_wakeup_handle_ = write_handle == read_handle;
+    updater_ = mgr.get();
+    pollset_->update(mgr, input_mask);
+    size_hint_.store(pollset_->size(), std::memory_order_relaxed);
     return none;
   }
 
   size_t num_socket_managers() const noexcept override {
-    return managers_.size();
+    return pollset_->size();
+  }
+
+  size_t num_socket_managers_hint() const noexcept override {
+    return size_hint_.load(std::memory_order_relaxed);
+  }
+
+  multiplexer* select_shard() noexcept override {
+    if (owner_ == nullptr)
+      return this;
+    return owner_->select_mpx();
   }
 
   middleman& owner() override {
@@ -286,7 +639,7 @@ public:
 
   bool poll_once(bool blocking) override {
     auto lg = log::net::trace("blocking = {}", blocking);
-    if (pollset_.empty())
+    if (pollset_->size() == 0)
       return false;
     // We'll call poll() until poll() succeeds or fails.
     for (;;) {
@@ -304,33 +657,27 @@ public:
           timeout = std::max(1, static_cast<int>(ms));
         }
       }
-      int presult =
-#ifdef CAF_WINDOWS
-        ::WSAPoll(pollset_.data(), static_cast<ULONG>(pollset_.size()),
-                  timeout);
-#else
-        ::poll(pollset_.data(), static_cast<nfds_t>(pollset_.size()), timeout);
-#endif
+      ready_.clear();
+      int presult = pollset_->wait(timeout, ready_);
       if (presult > 0) {
-        log::net::debug("poll() on {} sockets reported event(s) {}",
-                        pollset_.size(), presult);
-        // Scan pollset for events.
-        if (auto revents = pollset_[0].revents; revents != 0) {
-          // Index 0 is always the pollset updater. This is the only handler
-          // that is allowed to modify pollset_ and managers_. Since this may
-          // very well mess with the for loop below, we process this handler
-          // first.
-          auto mgr = managers_[0];
-          handle(mgr, pollset_[0].events, revents);
-          --presult;
+        log::net::debug("{}() on {} sockets reported event(s) {}",
+                        pollset_->name(), pollset_->size(), presult);
+        // The pollset updater is the only handler that is allowed to modify
+        // the pollset. Since this may very well mess with the for loop below,
+        // we process this handler first.
+        for (auto& ev : ready_) {
+          if (ev.mgr.get() == updater_) {
+            handle(ev.mgr, ev.events, ev.revents);
+            break;
+          }
         }
         apply_updates();
-        for (size_t i = 1; i < pollset_.size() && presult > 0; ++i) {
-          if (auto revents = pollset_[i].revents; revents != 0) {
-            handle(managers_[i], pollset_[i].events, revents);
-            --presult;
-          }
+        for (auto& ev : ready_) {
+          // Skip managers that the pollset updater has removed.
+          if (ev.mgr.get() != updater_ && pollset_->contains(ev.mgr.get()))
+            handle(ev.mgr, ev.events, ev.revents);
         }
+        ready_.clear();
         run_timeouts();
         return true;
       }
@@ -347,7 +694,8 @@ public:
           break;
         }
         case std::errc::not_enough_memory: {
-          log::system::error("poll() failed due to insufficient memory");
+          log::system::error("{}() failed due to insufficient memory",
+                             pollset_->name());
           // There's not much we can do other than try again in hope someone
           // else releases memory.
           break;
@@ -356,7 +704,8 @@ public:
           // Must not happen.
           auto int_code = static_cast<int>(code);
           auto msg = std::generic_category().message(int_code);
-          detail::panic("poll() failed: {} (error code: {})", msg, int_code);
+          detail::panic("{}() failed: {} (error code: {})", pollset_->name(),
+                        msg, int_code);
         }
       }
     }
@@ -379,22 +728,10 @@ public:
     log::net::debug("apply {} updates", updates_.size());
     for (;;) {
       if (!updates_.empty()) {
-        for (auto& [mgr, events] : updates_) {
-          if (auto index = index_of(mgr); index == -1) {
-            if (events != 0) {
-              pollfd new_entry{mgr->handle().id, events, 0};
-              pollset_.emplace_back(new_entry);
-              managers_.emplace_back(mgr);
-            }
-          } else if (events != 0) {
-            pollset_[index].events = events;
-            managers_[index] = mgr;
-          } else {
-            pollset_.erase(pollset_.begin() + index);
-            managers_.erase(managers_.begin() + index);
-          }
-        }
+        for (auto& [mgr, events] : updates_)
+          pollset_->update(mgr, events);
         updates_.clear();
+        size_hint_.store(pollset_->size(), std::memory_order_relaxed);
       }
       while (!pending_actions.empty()) {
         auto next = std::move(pending_actions.front());
@@ -413,23 +750,31 @@ public:
 
   void run() override {
     auto lg = log::net::trace("");
-    log::net::debug("run default_multiplexer input_mask = {}, error_mask = {}, "
-                    "output_mask = {}",
-                    input_mask, error_mask, output_mask);
+    log::net::debug("run default_multiplexer with backend {}, input_mask = {}, "
+                    "error_mask = {}, output_mask = {}",
+                    pollset_->name(), input_mask, error_mask, output_mask);
     // On systems like Linux, we cannot disable sigpipe on the socket alone. We
     // need to block the signal at thread level since some APIs (such as
     // OpenSSL) are unsafe to call otherwise.
     block_sigpipe();
-    while (!shutting_down_ || pollset_.size() > 1 || !watched_.empty()) {
+    while (!shutting_down_ || pollset_->size() > 1 || !watched_.empty()) {
       poll_once(true);
       disposable::erase_disposed(watched_);
     }
     // Close the pipe to block any future event.
-    std::lock_guard<std::mutex> guard{write_lock_};
-    if (write_handle_ != invalid_socket) {
-      close(write_handle_);
-      write_handle_ = pipe_socket{};
+    std::vector<pollset_updater::message> dropped;
+    {
+      std::lock_guard<std::mutex> guard{write_lock_};
+      if (write_handle_ != invalid_socket) {
+        // With an eventfd, the pollset updater owns the handle.
+        if (!shared_wakeup_handle_)
+          close(write_handle_);
+        write_handle_ = pipe_socket{};
+      }
+      dropped.swap(inbox_);
     }
+    for (auto& msg : dropped)
+      pollset_updater::discard(msg);
   }
 
   // -- internal callbacks the pollset updater ---------------------------------
@@ -440,9 +785,10 @@ public:
     log::net::debug("initiate shutdown");
     shutting_down_ = true;
     apply_updates();
-    // Skip the first manager (the pollset updater).
-    for (size_t i = 1; i < managers_.size(); ++i)
-      managers_[i]->dispose();
+    // Skip the pollset updater.
+    for (auto& mgr : pollset_->managers())
+      if (mgr.get() != updater_)
+        mgr->dispose();
     apply_updates();
   }
 
@@ -465,21 +811,23 @@ public:
     return false;
   }
 
-  // -- utility functions ------------------------------------------------------
-
-  /// Returns the index of `mgr` in the pollset or `-1`.
-  ptrdiff_t index_of(const socket_manager* mgr) const noexcept {
-    auto first = managers_.begin();
-    auto last = managers_.end();
-    auto i = std::find(first, last, mgr);
-    return i == last ? -1 : std::distance(first, i);
+  /// Stops other threads from using the read handle of the pollset updater
+  /// for waking up the multiplexer. Called by the pollset updater before
+  /// releasing its handle.
+  void release_wakeup_handle() {
+    std::lock_guard<std::mutex> guard{write_lock_};
+    if (shared_wakeup_handle_)
+      write_handle_ = pipe_socket{};
   }
 
-  /// Returns the index of `mgr` in the pollset or `-1`.
-  ptrdiff_t index_of(const socket_manager_ptr& mgr) const noexcept {
-    return index_of(mgr.get());
+  /// Moves all pending messages from other threads to `out`.
+  void take_inbox(std::vector<pollset_updater::message>& out) {
+    std::lock_guard<std::mutex> guard{write_lock_};
+    out.swap(inbox_);
   }
 
+  // -- utility functions ------------------------------------------------------
+
   /// Handles an I/O event on given manager.
   void handle(const socket_manager_ptr& mgr, [[maybe_unused]] short events,
               short revents) {
@@ -525,13 +873,8 @@ public:
     if (auto i = updates_.find(mgr); i != updates_.end()) {
       return i->second;
     }
-    if (auto index = index_of(mgr); index != -1) {
-      updates_.container().emplace_back(socket_manager_ptr{mgr, add_ref},
-                                        pollset_[index].events);
-      return updates_.container().back().second;
-    }
     updates_.container().emplace_back(socket_manager_ptr{mgr, add_ref},
-                                      short{0});
+                                      pollset_->events_of(mgr));
     return updates_.container().back().second;
   }
 
@@ -539,37 +882,40 @@ public:
     return update_for(mgr.get());
   }
 
-  /// Writes `opcode` and `ptr` to the pipe for handling an event later via the
-  /// pollset updater.
+  /// Passes `opcode` and `ptr` to the multiplexer thread for handling an event
+  /// later via the pollset updater.
   /// @warning assumes ownership of @p ptr.
   template <class T>
-  bool write_to_pipe(uint8_t opcode, T* ptr) {
-    pollset_updater::msg_buf buf;
+  bool write_to_pipe(pollset_updater::code opcode, T* ptr) {
     // Note: no intrusive_ptr_add_ref(ptr) since we take ownership of `ptr`.
-    buf[0] = static_cast<std::byte>(opcode);
-    auto value = reinterpret_cast<intptr_t>(ptr);
-    memcpy(buf.data() + 1, &value, sizeof(intptr_t));
+    pollset_updater::message msg{opcode, reinterpret_cast<intptr_t>(ptr)};
     ptrdiff_t res = -1;
     { // Lifetime scope of guard.
       std::lock_guard<std::mutex> guard{write_lock_};
-      if (write_handle_ != invalid_socket)
-        res = write(write_handle_, buf);
-    }
-    if constexpr (std::is_base_of_v<detail::atomic_ref_counted, T>) {
-      if (res <= 0 && ptr)
-        intrusive_ptr_release(ptr);
-    } else {
-      if (res <= 0 && ptr)
-        delete ptr;
+      if (write_handle_ != invalid_socket) {
+        inbox_.push_back(msg);
+        // Only the first message needs to wake up the multiplexer, because the
+        // pollset updater always processes all messages at once.
+        res = inbox_.size() == 1 ? notify() : 1;
+        if (res <= 0)
+          inbox_.pop_back();
+      }
     }
+    if (res <= 0)
+      pollset_updater::discard(msg);
     return res > 0;
   }
 
-  /// @copydoc write_to_pipe
-  template <class Enum, class T>
-    requires std::is_enum_v<Enum>
-  bool write_to_pipe(Enum opcode, T* ptr) {
-    return write_to_pipe(static_cast<uint8_t>(opcode), ptr);
+  /// Signals the pollset updater.
+  /// @pre `write_lock_` is locked
+  ptrdiff_t notify() {
+#ifdef CAF_LINUX
+    uint64_t value = 1;
+    return write(write_handle_, as_bytes(std::span{&value, 1}));
+#else
+    std::byte value{0};
+    return write(write_handle_, std::span{&value, 1});
+#endif
   }
 
   /// Queries the currently active event bitmask for `mgr`.
@@ -577,10 +923,7 @@ public:
     if (auto i = updates_.find(mgr); i != updates_.end()) {
       return i->second;
     }
-    if (auto index = index_of(mgr); index != -1) {
-      return pollset_[index].events;
-    }
-    return 0;
+    return pollset_->events_of(mgr);
   }
 
   /// Pending actions to run immediately.
@@ -596,11 +939,13 @@ private:
   // -- member variables -------------------------------------------------------
 
   /// Bookkeeping data for managed sockets.
-  pollfd_list pollset_;
+  std::unique_ptr<pollset_backend> pollset_;
 
-  /// Maps sockets to their owning managers by storing the managers in the same
-  /// order as their sockets appear in `pollset_`.
-  manager_list managers_;
+  /// Stores the events that the pollset reported in the current iteration.
+  std::vector<ready_event> ready_;
+
+  /// Points to the manager of the pollset updater.
+  socket_manager* updater_ = nullptr;
 
   /// Caches changes to the events mask of managed sockets until they can safely
   /// take place.
@@ -610,15 +955,25 @@ private:
   /// calling `init()`.
   std::thread::id tid_;
 
-  /// Guards `write_handle_`.
+  /// Guards `write_handle_` and `inbox_`.
   std::mutex write_lock_;
 
-  /// Used for pushing updates to the multiplexer's thread.
+  /// Used for waking up the multiplexer's thread.
   pipe_socket write_handle_;
 
+  /// Stores whether `write_handle_` is also the read handle of the pollset
+  /// updater, i.e., whether it refers to an eventfd.
+  bool shared_wakeup_handle_ = false;
+
+  /// Stores updates from other threads until the pollset updater runs.
+  std::vector<pollset_updater::message> inbox_;
+
   /// Points to the owning middleman.
   middleman* owner_;
 
+  /// Caches the size of the pollset for other threads.
+  std::atomic<size_t> size_hint_ = 0;
+
   /// Signals whether shutdown has been requested.
   bool shutting_down_ = false;
 
@@ -633,63 +988,84 @@ error pollset_updater::start(socket_manager* owner) {
   return nonblocking(fd_, true);
 }
 
+void pollset_updater::discard(const message& msg) {
+  if (msg.ptr == 0)
+    return;
+  switch (msg.opcode) {
+    case code::start_manager:
+      intrusive_ptr_release(reinterpret_cast<socket_manager*>(msg.ptr));
+      break;
+    case code::run_action:
+      intrusive_ptr_release(reinterpret_cast<action::impl*>(msg.ptr));
+      break;
+    case code::delay_action: {
+      using value_type = default_multiplexer::scheduled_actions_map::value_type;
+      delete reinterpret_cast<value_type*>(msg.ptr);
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+void pollset_updater::handle(const message& msg) {
+  switch (msg.opcode) {
+    case code::start_manager:
+      mpx_->do_start(intrusive_ptr{reinterpret_cast<socket_manager*>(msg.ptr),
+                                   adopt_ref});
+      break;
+    case code::run_action: {
+      auto f = action{intrusive_ptr{reinterpret_cast<action::impl*>(msg.ptr),
+                                    adopt_ref}};
+      mpx_->pending_actions.push_back(std::move(f));
+      break;
+    }
+    case code::delay_action: {
+      using value_type = default_multiplexer::scheduled_actions_map::value_type;
+      auto val = std::unique_ptr<value_type>{
+        reinterpret_cast<value_type*>(msg.ptr)};
+      mpx_->scheduled_actions.emplace(val->first, std::move(val->second));
+      break;
+    }
+    case code::shutdown:
+      CAF_ASSERT(msg.ptr == 0);
+      mpx_->do_shutdown();
+      break;
+    default:
+      log::system::error("invalid opcode in pollset updater: {}",
+                         static_cast<uint8_t>(msg.opcode));
+      discard(msg);
+      break;
+  }
+}
+
 void pollset_updater::handle_read_event() {
   auto lg = log::net::trace("");
-  auto as_mgr = [](intptr_t ptr) {
-    return intrusive_ptr{reinterpret_cast<socket_manager*>(ptr), adopt_ref};
-  };
-  auto add_action = [this](intptr_t ptr) {
-    auto f
-      = action{intrusive_ptr{reinterpret_cast<action::impl*>(ptr), adopt_ref}};
-    mpx_->pending_actions.push_back(std::move(f));
-  };
-  auto delay_action = [this](intptr_t ptr) {
-    using value_type = default_multiplexer::scheduled_actions_map::value_type;
-    auto val = std::unique_ptr<value_type>{reinterpret_cast<value_type*>(ptr)};
-    mpx_->scheduled_actions.emplace(val->first, std::move(val->second));
-  };
+  // Reset the wakeup handle before taking the messages. Otherwise, we could
+  // miss a notification for a message that arrives after taking the inbox.
+  std::array<std::byte, 64> buf;
   for (;;) {
-    CAF_ASSERT((buf_.size() - buf_size_) > 0);
-    auto num_bytes
-      = read(fd_, std::span{buf_.data() + buf_size_, buf_.size() - buf_size_});
+    auto num_bytes = read(fd_, buf);
     if (num_bytes > 0) {
-      buf_size_ += static_cast<size_t>(num_bytes);
-      if (buf_.size() == buf_size_) {
-        buf_size_ = 0;
-        auto opcode = static_cast<uint8_t>(buf_[0]);
-        intptr_t ptr;
-        memcpy(&ptr, buf_.data() + 1, sizeof(intptr_t));
-        switch (static_cast<code>(opcode)) {
-          case code::start_manager:
-            mpx_->do_start(as_mgr(ptr));
-            break;
-          case code::run_action:
-            add_action(ptr);
-            break;
-          case code::delay_action:
-            delay_action(ptr);
-            break;
-          case code::shutdown:
-            CAF_ASSERT(ptr == 0);
-            mpx_->do_shutdown();
-            break;
-          default:
-            log::system::error("invalid opcode in pollset updater: {}", opcode);
-            break;
-        }
-      }
+      continue;
     } else if (num_bytes == 0) {
       log::net::debug("pipe closed, assume shutdown");
+      mpx_->release_wakeup_handle();
       owner_->deregister();
       return;
     } else if (last_socket_error_is_temporary()) {
-      return;
+      break;
     } else {
       log::system::error("pollset updater failed to read from its pipe");
+      mpx_->release_wakeup_handle();
       owner_->deregister();
       return;
     }
   }
+  mpx_->take_inbox(inbox_);
+  for (auto& msg : inbox_)
+    handle(msg);
+  inbox_.clear();
 }
 
 } // namespace
@@ -712,7 +1088,31 @@ void multiplexer::block_sigpipe() {
 }
 
 multiplexer_ptr multiplexer::make(middleman* parent) {
-  return make_counted<default_multiplexer>(parent);
+  if (parent != nullptr) {
+    auto backend = get_or(parent->system().config(), "caf.net.multiplexer",
+                          defaults::net::multiplexer);
+    if (backend == "epoll")
+      return make_epoll(parent);
+    if (backend != "poll")
+      log::net::warning("unrecognized multiplexer backend {}, falling back "
+                        "to poll",
+                        backend);
+  }
+  return make_poll(parent);
+}
+
+multiplexer_ptr multiplexer::make_poll(middleman* parent) {
+  return make_counted<default_multiplexer>(parent,
+                                           std::make_unique<poll_backend>());
+}
+
+multiplexer_ptr multiplexer::make_epoll(middleman* parent) {
+#ifdef CAF_LINUX
+  return make_counted<default_multiplexer>(parent,
+                                           std::make_unique<epoll_backend>());
+#else
+  return make_poll(parent);
+#endif
 }
 
 multiplexer* multiplexer::from(actor_system& sys) {
@@ -42,13 +42,23 @@ public:
 
   // -- factories --------------------------------------------------------------
 
-  /// Creates a new multiplexer instance with the default implementation.
+  /// Creates a new multiplexer instance with the implementation selected by
+  /// `caf.net.multiplexer` (`poll` by default).
   /// @param parent Points to the owning middleman instance. May be `nullptr`
   ///               only for the purpose of unit testing if no @ref
   ///               socket_manager requires access to the @ref middleman or the
   ///               @ref actor_system.
   static multiplexer_ptr make(middleman* parent);
 
+  /// Creates a new multiplexer instance that waits for I/O events via `poll`.
+  /// @param parent Points to the owning middleman instance or `nullptr`.
+  static multiplexer_ptr make_poll(middleman* parent);
+
+  /// Creates a new multiplexer instance that waits for I/O events via `epoll`.
+  /// Falls back to `make_poll` on platforms other than Linux.
+  /// @param parent Points to the owning middleman instance or `nullptr`.
+  static multiplexer_ptr make_epoll(middleman* parent);
+
   // -- initialization ---------------------------------------------------------
 
   virtual error init() = 0;
@@ -72,6 +82,17 @@ public:
   /// Returns the number of currently active socket managers.
   virtual size_t num_socket_managers() const noexcept = 0;
 
+  /// Returns the number of socket managers as of the last update of the
+  /// pollset. Other threads may call this function to estimate the load of the
+  /// multiplexer.
+  /// @threadsafe
+  virtual size_t num_socket_managers_hint() const noexcept = 0;
+
+  /// Selects a multiplexer for running a new socket manager. Returns `this`
+  /// unless the owning @ref middleman runs multiple multiplexers.
+  /// @threadsafe
+  virtual multiplexer* select_shard() noexcept = 0;
+
   /// Returns the owning @ref middleman instance.
   virtual middleman& owner() = 0;
 
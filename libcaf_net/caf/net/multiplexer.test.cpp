@@ -175,6 +175,15 @@ struct fixture {
   net::multiplexer_ptr mpx;
 };
 
+/// Runs the same tests with the epoll backend. Falls back to poll on platforms
+/// other than Linux.
+struct epoll_fixture : fixture {
+  epoll_fixture() {
+    mpx = net::multiplexer::make_epoll(nullptr);
+    mpx->set_thread_id();
+  }
+};
+
 template <class T>
 T unbox(caf::expected<T> x) {
   if (!x)
@@ -295,3 +304,69 @@ SCENARIO("a multiplexer terminates its thread after shutting down") {
 // }
 
 } // WITH_FIXTURE(fixture)
+
+WITH_FIXTURE(epoll_fixture) {
+
+SCENARIO("an epoll multiplexer runs callbacks on socket activity") {
+  GIVEN("an initialized multiplexer") {
+    init();
+    check_eq(mpx->num_socket_managers(), 1u);
+    WHEN("socket managers register for read and write operations") {
+      auto [alice_fd, bob_fd] = unbox(net::make_stream_socket_pair());
+      auto [alice, alice_mgr] = make_manager(alice_fd, "Alice");
+      auto [bob, bob_mgr] = make_manager(bob_fd, "Bob");
+      alice_mgr->register_reading();
+      bob_mgr->register_reading();
+      apply_updates();
+      check_eq(mpx->num_socket_managers(), 3u);
+      THEN("the multiplexer runs callbacks on socket activity") {
+        alice->send("Hello Bob!");
+        alice_mgr->register_writing();
+        exhaust();
+        check_eq(bob->receive(), "Hello Bob!");
+        check(!mpx->is_writing(alice_mgr.get()));
+        bob->send("Hello Alice!");
+        bob_mgr->register_writing();
+        exhaust();
+        check_eq(alice->receive(), "Hello Alice!");
+      }
+      AND_THEN("deregistering a manager removes it from the pollset") {
+        bob_mgr->deregister();
+        apply_updates();
+        check_eq(mpx->num_socket_managers(), 2u);
+        check(!mpx->is_reading(bob_mgr.get()));
+        check(mpx->is_reading(alice_mgr.get()));
+      }
+    }
+  }
+}
+
+SCENARIO("an epoll multiplexer runs actions from other threads") {
+  GIVEN("a multiplexer running in its own thread") {
+    init();
+    auto go_time = std::make_shared<detail::latch>(2);
+    auto mpx_thread = std::thread{[this, go_time] {
+      mpx->set_thread_id();
+      go_time->count_down_and_wait();
+      mpx->run();
+    }};
+    go_time->count_down_and_wait();
+    WHEN("scheduling actions from another thread") {
+      auto done = std::make_shared<detail::latch>(2);
+      auto count = std::make_shared<std::atomic<size_t>>(0);
+      for (size_t i = 0; i < 100; ++i)
+        mpx->schedule_fn([count, done] {
+          if (++*count == 100)
+            done->count_down();
+        });
+      THEN("the multiplexer runs all actions") {
+        done->count_down_and_wait();
+        check_eq(count->load(), 100u);
+      }
+    }
+    mpx->shutdown();
+    mpx_thread.join();
+  }
+}
+
+} // WITH_FIXTURE(epoll_fixture)
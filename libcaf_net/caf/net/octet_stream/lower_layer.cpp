@@ -4,10 +4,24 @@
 
 #include "caf/net/octet_stream/lower_layer.hpp"
 
+#include "caf/byte_buffer.hpp"
+#include "caf/chunk.hpp"
+
 namespace caf::net::octet_stream {
 
 lower_layer::~lower_layer() {
   // nop
 }
 
+void lower_layer::enqueue_output(chunk buf) {
+  auto bytes = buf.bytes();
+  auto& out = output_buffer();
+  out.insert(out.end(), bytes.begin(), bytes.end());
+}
+
+void lower_layer::enqueue_output(byte_buffer&& buf) {
+  auto& out = output_buffer();
+  out.insert(out.end(), buf.begin(), buf.end());
+}
+
 } // namespace caf::net::octet_stream
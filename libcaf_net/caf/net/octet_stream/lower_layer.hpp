@@ -10,12 +10,17 @@
 #include "caf/detail/net_export.hpp"
 #include "caf/fwd.hpp"
 
+#include <cstddef>
+
 namespace caf::net::octet_stream {
 
 /// Provides access to a resource that operates on a byte stream, e.g., a TCP
 /// socket.
 class CAF_NET_EXPORT lower_layer : public generic_lower_layer {
 public:
+  /// Buffers below this size are cheaper to copy than to write separately.
+  static constexpr size_t min_enqueue_size = 1024;
+
   ~lower_layer() override;
 
   /// Configures threshold for the next receive operations. Policies remain
@@ -36,6 +41,18 @@ public:
   /// registering sockets for write events.
   virtual bool end_output() = 0;
 
+  /// Appends `buf` to the output after all bytes in the output buffer. Layers
+  /// with support for scatter-gather I/O keep a reference to the chunk instead
+  /// of copying it. Users may only call this function between calling
+  /// `begin_output()` and `end_output()`.
+  virtual void enqueue_output(chunk buf);
+
+  /// Appends `buf` to the output after all bytes in the output buffer. Layers
+  /// with support for scatter-gather I/O take ownership of the buffer instead
+  /// of copying it. Users may only call this function between calling
+  /// `begin_output()` and `end_output()`.
+  virtual void enqueue_output(byte_buffer&& buf);
+
   /// Asks the stream to swap the current upper layer with `next` after
   /// returning from `consume()`.
   /// @note may only be called from the upper layer in `consume`.
@@ -9,4 +9,11 @@ policy::~policy() {
   // nop
 }
 
+ptrdiff_t policy::writev(std::span<const const_byte_span> bufs) {
+  for (auto buf : bufs)
+    if (!buf.empty())
+      return write(buf);
+  return 0;
+}
+
 } // namespace caf::net::octet_stream
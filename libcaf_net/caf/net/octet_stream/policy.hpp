@@ -10,6 +10,7 @@
 #include "caf/fwd.hpp"
 
 #include <cstdint>
+#include <span>
 
 namespace caf::net::octet_stream {
 
@@ -28,6 +29,10 @@ public:
   /// Writes data from the buffer to the socket.
   virtual ptrdiff_t write(const_byte_span buf) = 0;
 
+  /// Writes data from multiple buffers to the socket. The default
+  /// implementation only writes the first non-empty buffer.
+  virtual ptrdiff_t writev(std::span<const const_byte_span> bufs);
+
   /// Returns the last socket error on this thread.
   virtual errc last_error(ptrdiff_t) = 0;
 
@@ -8,11 +8,17 @@
 #include "caf/net/receive_policy.hpp"
 #include "caf/net/socket_manager.hpp"
 
+#include "caf/byte_buffer.hpp"
+#include "caf/chunk.hpp"
 #include "caf/defaults.hpp"
 #include "caf/detail/assert.hpp"
 #include "caf/expected.hpp"
 #include "caf/log/net.hpp"
 
+#include <deque>
+#include <span>
+#include <variant>
+
 namespace caf::net::octet_stream {
 
 namespace {
@@ -35,6 +41,10 @@ public:
     return net::write(fd, buf);
   }
 
+  ptrdiff_t writev(std::span<const const_byte_span> bufs) override {
+    return net::write(fd, bufs);
+  }
+
   errc last_error(ptrdiff_t) override {
     return last_socket_error_is_temporary() ? errc::temporary : errc::permanent;
   }
@@ -97,7 +107,7 @@ public:
   }
 
   bool can_send_more() const noexcept override {
-    return write_buf_.size() < max_write_buf_size_;
+    return write_buf_.size() + queued_ < max_write_buf_size_;
   }
 
   void configure_read(receive_policy rd) override {
@@ -124,7 +134,7 @@ public:
   }
 
   void begin_output() override {
-    if (write_buf_.empty())
+    if (!has_pending_output())
       parent_->register_writing();
   }
 
@@ -136,6 +146,27 @@ public:
     return true;
   }
 
+  void enqueue_output(chunk buf) override {
+    if (buf.size() < min_enqueue_size) {
+      auto bytes = buf.bytes();
+      write_buf_.insert(write_buf_.end(), bytes.begin(), bytes.end());
+      return;
+    }
+    seal_write_buf();
+    queued_ += buf.size();
+    segments_.emplace_back(std::move(buf));
+  }
+
+  void enqueue_output(byte_buffer&& buf) override {
+    if (buf.size() < min_enqueue_size) {
+      write_buf_.insert(write_buf_.end(), buf.begin(), buf.end());
+      return;
+    }
+    seal_write_buf();
+    queued_ += buf.size();
+    segments_.emplace_back(std::move(buf));
+  }
+
   bool is_reading() const noexcept override {
     return max_read_size_ > 0;
   }
@@ -145,7 +176,7 @@ public:
   }
 
   void shutdown() override {
-    if (write_buf_.empty()) {
+    if (!has_pending_output()) {
       parent_->shutdown();
     } else {
       configure_read(receive_policy::stop());
@@ -276,7 +307,7 @@ public:
     }
     // When shutting down, we flush our buffer and then shut down the manager.
     if (flags_.shutting_down) {
-      if (write_buf_.empty()) {
+      if (!has_pending_output()) {
         parent_->shutdown();
         return;
       }
@@ -284,11 +315,12 @@ public:
       // Allow the upper layer to add extra data to the write buffer.
       up_->prepare_send();
     }
-    auto write_res = policy_->write(write_buf_);
+    auto write_res = segments_.empty() ? policy_->write(write_buf_)
+                                       : write_segments();
     if (write_res > 0) {
-      write_buf_.erase(write_buf_.begin(), write_buf_.begin() + write_res);
+      drop_written(static_cast<size_t>(write_res));
       up_->written(static_cast<size_t>(write_res));
-      if (write_buf_.empty() && up_->done_sending()) {
+      if (!has_pending_output() && up_->done_sending()) {
         if (!flags_.shutting_down) {
           parent_->deregister_writing();
         } else {
@@ -324,12 +356,84 @@ public:
   }
 
   bool finalized() const noexcept override {
-    return write_buf_.empty();
+    return !has_pending_output();
   }
 
 protected:
+  // -- member types -----------------------------------------------------------
+
+  /// A segment of the output that the transport writes without copying it to
+  /// the write buffer first.
+  using segment = std::variant<chunk, byte_buffer>;
+
   // -- utility functions ------------------------------------------------------
 
+  /// Checks whether the transport has any data left to write.
+  bool has_pending_output() const noexcept {
+    return !write_buf_.empty() || !segments_.empty();
+  }
+
+  /// Returns the bytes of `x`.
+  static const_byte_span bytes_of(const segment& x) noexcept {
+    if (auto* ck = std::get_if<chunk>(&x))
+      return ck->bytes();
+    return std::get<byte_buffer>(x);
+  }
+
+  /// Moves the content of the write buffer to the segments, because new
+  /// segments must not overtake bytes that are already in the write buffer.
+  void seal_write_buf() {
+    if (write_buf_.empty())
+      return;
+    queued_ += write_buf_.size();
+    if (write_buf_.size() < min_enqueue_size) {
+      // Copy small buffers to keep the capacity of the write buffer.
+      segments_.emplace_back(byte_buffer{write_buf_.begin(), write_buf_.end()});
+      write_buf_.clear();
+    } else {
+      segments_.emplace_back(std::move(write_buf_));
+      write_buf_ = byte_buffer{};
+    }
+  }
+
+  /// Writes all segments followed by the write buffer with a single
+  /// scatter-gather write.
+  ptrdiff_t write_segments() {
+    CAF_ASSERT(!segments_.empty());
+    const_byte_span bufs[max_write_buffers];
+    size_t num_bufs = 0;
+    for (auto& x : segments_) {
+      if (num_bufs == max_write_buffers)
+        break;
+      bufs[num_bufs++] = bytes_of(x);
+    }
+    bufs[0] = bufs[0].subspan(segment_offset_);
+    if (num_bufs < max_write_buffers && !write_buf_.empty())
+      bufs[num_bufs++] = write_buf_;
+    return policy_->writev(std::span{bufs, num_bufs});
+  }
+
+  /// Removes `num_bytes` from the front of the output after a write.
+  void drop_written(size_t num_bytes) {
+    while (num_bytes > 0 && !segments_.empty()) {
+      auto remaining = bytes_of(segments_.front()).size() - segment_offset_;
+      if (num_bytes < remaining) {
+        segment_offset_ += num_bytes;
+        queued_ -= num_bytes;
+        return;
+      }
+      num_bytes -= remaining;
+      queued_ -= remaining;
+      segment_offset_ = 0;
+      segments_.pop_front();
+    }
+    if (num_bytes > 0) {
+      CAF_ASSERT(num_bytes <= write_buf_.size());
+      write_buf_.erase(write_buf_.begin(),
+                       write_buf_.begin() + static_cast<ptrdiff_t>(num_bytes));
+    }
+  }
+
   /// Consumes as much data from the buffer as possible.
   void handle_buffered_data() {
     auto lg = log::net::trace("buffered_ = {}", buffered_);
@@ -407,6 +511,9 @@ protected:
       // Clear the write buffer since we can't send it anyway - this ensures
       // finalized() returns true and cleanup() will be called.
       write_buf_.clear();
+      segments_.clear();
+      segment_offset_ = 0;
+      queued_ = 0;
       parent_->deregister();
       parent_->shutdown();
     }
@@ -443,6 +550,15 @@ protected:
   /// Caches outgoing data.
   byte_buffer write_buf_;
 
+  /// Stores outgoing data that precedes the content of `write_buf_`.
+  std::deque<segment> segments_;
+
+  /// Stores how many bytes of the first segment the transport has written.
+  size_t segment_offset_ = 0;
+
+  /// Stores how many bytes in `segments_` still wait for transfer.
+  size_t queued_ = 0;
+
   /// Processes incoming data and generates outgoing data.
   upper_layer_ptr up_;
 
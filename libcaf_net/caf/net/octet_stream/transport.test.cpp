@@ -15,12 +15,14 @@
 #include "caf/binary_deserializer.hpp"
 #include "caf/binary_serializer.hpp"
 #include "caf/byte_buffer.hpp"
+#include "caf/chunk.hpp"
 #include "caf/detail/scope_guard.hpp"
 #include "caf/log/test.hpp"
 #include "caf/make_actor.hpp"
 
 #include <algorithm>
 #include <span>
+#include <vector>
 
 using namespace caf;
 
@@ -115,6 +117,57 @@ private:
   consume_impl_t consume_impl_;
 };
 
+/// Writes `parts` once, alternating between the output buffer and enqueueing
+/// buffers to the transport.
+class mock_writer : public os::upper_layer {
+public:
+  explicit mock_writer(std::vector<byte_buffer> parts)
+    : parts_(std::move(parts)) {
+    // nop
+  }
+
+  error start(os::lower_layer* down_ptr) override {
+    down = down_ptr;
+    return none;
+  }
+
+  void abort(const error&) override {
+    CAF_RAISE_ERROR("abort called");
+  }
+
+  ptrdiff_t consume(byte_span, byte_span) override {
+    return -1;
+  }
+
+  void prepare_send() override {
+    if (parts_.empty())
+      return;
+    down->begin_output();
+    for (size_t index = 0; index < parts_.size(); ++index) {
+      auto& part = parts_[index];
+      if (index % 3 == 0) {
+        auto& buf = down->output_buffer();
+        buf.insert(buf.end(), part.begin(), part.end());
+      } else if (index % 3 == 1) {
+        down->enqueue_output(chunk{part});
+      } else {
+        down->enqueue_output(std::move(part));
+      }
+    }
+    down->end_output();
+    parts_.clear();
+  }
+
+  bool done_sending() override {
+    return parts_.empty();
+  }
+
+  os::lower_layer* down = nullptr;
+
+private:
+  std::vector<byte_buffer> parts_;
+};
+
 } // namespace
 
 WITH_FIXTURE(fixture) {
@@ -220,4 +273,41 @@ TEST("switching the protocol resets the delta") {
   }
 }
 
+TEST("enqueued buffers follow the content of the output buffer") {
+  // Generate parts with various sizes, some of them large enough to require
+  // multiple writes.
+  std::vector<byte_buffer> parts;
+  byte_buffer expected;
+  auto next_byte = uint8_t{0};
+  for (size_t size : {3u, 2'000u, 100'000u, 7u, 10u, 4'096u, 50'000u, 1u,
+                      300'000u, 20u}) {
+    byte_buffer part;
+    for (size_t i = 0; i < size; ++i)
+      part.push_back(static_cast<std::byte>(next_byte++));
+    expected.insert(expected.end(), part.begin(), part.end());
+    parts.emplace_back(std::move(part));
+  }
+  auto writer = std::make_unique<mock_writer>(std::move(parts));
+  auto transport = os::transport::make(recv_socket_guard.release(),
+                                       std::move(writer));
+  auto mgr = net::socket_manager::make(mpx.get(), std::move(transport));
+  check_eq(mgr->start(), none);
+  mpx->apply_updates();
+  mgr->register_writing();
+  mpx->apply_updates();
+  if (auto err = nonblocking(send_socket_guard.socket(), true); err.valid())
+    fail("failed to set socket to nonblocking: {}", err);
+  byte_buffer received;
+  byte_buffer rd_buf(65'536);
+  for (size_t round = 0;
+       received.size() < expected.size() && round < 100'000; ++round) {
+    handle_io_event();
+    auto res = read(send_socket_guard.socket(), std::span{rd_buf});
+    if (res > 0)
+      received.insert(received.end(), rd_buf.begin(), rd_buf.begin() + res);
+  }
+  check_eq(received.size(), expected.size());
+  check(received == expected);
+}
+
 } // WITH_FIXTURE(fixture)
@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <span>
 
 #ifdef CAF_POSIX
@@ -187,6 +188,23 @@ ptrdiff_t write(stream_socket x, std::initializer_list<const_byte_span> bufs) {
   return (res == 0) ? bytes_sent : -1;
 }
 
+ptrdiff_t write(stream_socket x, std::span<const const_byte_span> bufs) {
+  auto lg = log::net::trace("socket = {}, buffers = {}", x.id, bufs.size());
+  if (bufs.size() > max_write_buffers)
+    bufs = bufs.first(max_write_buffers);
+  WSABUF buf_array[max_write_buffers];
+  auto convert = [](const_byte_span buf) {
+    auto data = const_cast<std::byte*>(buf.data());
+    return WSABUF{static_cast<ULONG>(buf.size()),
+                  reinterpret_cast<CHAR*>(data)};
+  };
+  std::ranges::transform(bufs, std::begin(buf_array), convert);
+  DWORD bytes_sent = 0;
+  auto res = WSASend(x.id, buf_array, static_cast<DWORD>(bufs.size()),
+                     &bytes_sent, 0, nullptr, nullptr);
+  return (res == 0) ? bytes_sent : -1;
+}
+
 #else // CAF_WINDOWS
 
 ptrdiff_t write(stream_socket x, std::initializer_list<const_byte_span> bufs) {
@@ -199,6 +217,24 @@ ptrdiff_t write(stream_socket x, std::initializer_list<const_byte_span> bufs) {
   return writev(x.id, buf_array, static_cast<int>(bufs.size()));
 }
 
+ptrdiff_t write(stream_socket x, std::span<const const_byte_span> bufs) {
+  auto lg = log::net::trace("socket = {}, buffers = {}", x.id, bufs.size());
+  if (bufs.size() > max_write_buffers)
+    bufs = bufs.first(max_write_buffers);
+  iovec buf_array[max_write_buffers];
+  auto convert = [](const_byte_span buf) {
+    return iovec{const_cast<std::byte*>(buf.data()), buf.size()};
+  };
+  std::ranges::transform(bufs, std::begin(buf_array), convert);
+  // Unlike `send`, `writev` has no flag for suppressing SIGPIPE. Hence, we use
+  // `sendmsg` instead.
+  msghdr msg;
+  memset(&msg, 0, sizeof(msghdr));
+  msg.msg_iov = buf_array;
+  msg.msg_iovlen = static_cast<decltype(msg.msg_iovlen)>(bufs.size());
+  return ::sendmsg(x.id, &msg, no_sigpipe_io_flag);
+}
+
 #endif // CAF_WINDOWS
 
 } // namespace caf::net
@@ -79,4 +79,18 @@ ptrdiff_t CAF_NET_EXPORT write(stream_socket x, const_byte_span buf);
 ptrdiff_t CAF_NET_EXPORT write(stream_socket x,
                                std::initializer_list<const_byte_span> bufs);
 
+/// Maximum number of buffers that a single scatter-gather write transmits.
+constexpr size_t max_write_buffers = 64;
+
+/// Transmits data from `x` to its peer with a single scatter-gather write.
+/// @param x A connected endpoint.
+/// @param bufs Points to the message to send, scattered across multiple
+///             buffers. Only the first `max_write_buffers` buffers are
+///             considered.
+/// @returns The number of written bytes on success, otherwise an error code.
+/// @relates stream_socket
+/// @post either the result is a `sec` or a positive (non-zero) integer
+ptrdiff_t CAF_NET_EXPORT write(stream_socket x,
+                               std::span<const const_byte_span> bufs);
+
 } // namespace caf::net
@@ -45,6 +45,31 @@ expected<tcp_accept_socket>
   CAF_NET_EXPORT make_tcp_accept_socket(const uri::authority_type& node,
                                         bool reuse_addr = true);
 
+/// Creates a new TCP socket to accept connections on a given port.
+/// @param node The endpoint to listen on and the filter for incoming addresses.
+///             Passing the address `0.0.0.0` will accept incoming connection
+///             from any host. Passing port 0 lets the OS choose the port.
+/// @param reuse_addr Sets the SO_REUSEADDR option on the socket.
+/// @param reuse_port Sets the SO_REUSEPORT option on the socket. Multiple
+///                   sockets with this option may listen on the same port, in
+///                   which case the OS distributes incoming connections to
+///                   all of them. Fails on platforms without SO_REUSEPORT.
+/// @relates tcp_accept_socket
+expected<tcp_accept_socket>
+  CAF_NET_EXPORT make_tcp_accept_socket(ip_endpoint node, bool reuse_addr,
+                                        bool reuse_port);
+
+/// Creates a new TCP socket to accept connections on a given port.
+/// @param node The endpoint to listen on and the filter for incoming addresses.
+///             Passing the address `0.0.0.0` will accept incoming connection
+///             from any host. Passing port 0 lets the OS choose the port.
+/// @param reuse_addr Sets the SO_REUSEADDR option on the socket.
+/// @param reuse_port Sets the SO_REUSEPORT option on the socket.
+/// @relates tcp_accept_socket
+expected<tcp_accept_socket>
+  CAF_NET_EXPORT make_tcp_accept_socket(const uri::authority_type& node,
+                                        bool reuse_addr, bool reuse_port);
+
 /// Creates a new TCP socket to accept connections on a given port.
 /// @param port The port for listening to incoming connection. Passing 0 lets
 ///             the OS choose a port.
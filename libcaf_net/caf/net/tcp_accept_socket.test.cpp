@@ -86,3 +86,29 @@ TEST("calling accept") {
              sec::socket_operation_failed);
   }
 }
+
+#ifndef CAF_WINDOWS
+
+TEST("multiple sockets may listen on the same port with SO_REUSEPORT") {
+  uri::authority_type auth;
+  auth.host = "127.0.0.1"s;
+  auth.port = 0;
+  auto first = make_tcp_accept_socket(auth, true, true);
+  require(first.has_value());
+  auto first_guard = make_socket_guard(*first);
+  auto port = local_port(*first);
+  require(port.has_value());
+  auth.port = *port;
+  SECTION("sockets with SO_REUSEPORT may share the port") {
+    auto second = make_tcp_accept_socket(auth, true, true);
+    require(second.has_value());
+    auto second_guard = make_socket_guard(*second);
+    check_eq(local_port(*second), *port);
+  }
+  SECTION("sockets without SO_REUSEPORT may not share the port") {
+    auto second = make_tcp_accept_socket(auth, true, false);
+    check(!second.has_value());
+  }
+}
+
+#endif // CAF_WINDOWS
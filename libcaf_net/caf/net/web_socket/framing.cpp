@@ -21,6 +21,7 @@
 #include <random>
 #include <span>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 
 namespace caf::net::web_socket {
@@ -404,6 +405,22 @@ private:
       detail::rfc6455::mask_data(mask_key, buf);
     }
     down_->begin_output();
+    if constexpr (std::is_same_v<T, std::byte>) {
+      // Hand large payloads over to the transport instead of copying them.
+      if (buf.size() >= octet_stream::lower_layer::min_enqueue_size) {
+        detail::rfc6455::assemble_header(detail::rfc6455::binary_frame,
+                                         mask_key, buf.size(),
+                                         down_->output_buffer());
+        auto capacity = buf.capacity();
+        down_->enqueue_output(std::move(buf));
+        down_->end_output();
+        // The transport owns the old buffer now. Allocate the new one at full
+        // size right away to avoid growing it again for the next large frame.
+        buf.clear();
+        buf.reserve(capacity);
+        return;
+      }
+    }
     detail::rfc6455::assemble_frame(mask_key, buf, down_->output_buffer());
     down_->end_output();
     buf.clear();
@@ -21,6 +21,8 @@
 #include "caf/internal/net_config.hpp"
 #include "caf/internal/ws_flow_bridge.hpp"
 
+#include <algorithm>
+
 namespace caf::net::web_socket {
 
 template <class Acceptor>
@@ -60,9 +62,9 @@ public:
     auto transport = internal::make_transport(std::move(*conn), std::move(ws));
     transport->max_consecutive_reads(max_consecutive_reads_);
     transport->active_policy().accept();
-    auto res = net::socket_manager::make(parent_->mpx_ptr(),
+    auto res = net::socket_manager::make(parent_->mpx().select_shard(),
                                          std::move(transport));
-    res->add_cleanup_listener(on_conn_close_);
+    res->add_cleanup_listener(make_close_listener(parent_, on_conn_close_));
     return res;
   }
 
@@ -223,6 +225,13 @@ with_t::server&& with_t::server::max_connections(size_t value) && {
   return std::move(*this);
 }
 
+with_t::server&& with_t::server::reuse_port(size_t num_listeners) && {
+  if (auto* lazy = std::get_if<internal::net_config::server_config::lazy>(
+        &config_->server.value))
+    lazy->num_listeners = std::max(num_listeners, size_t{1});
+  return std::move(*this);
+}
+
 void with_t::server::set_acceptor(detail::ws_conn_acceptor_ptr acc) {
   config_->acceptor = std::move(acc);
 }
@@ -292,7 +301,7 @@ with_t with(multiplexer* mpx) {
 }
 
 with_t with(actor_system& sys) {
-  return with(multiplexer::from(sys));
+  return with(multiplexer::from(sys)->select_shard());
 }
 
 with_t::with_t(multiplexer* mpx) : config_(new config_impl(mpx)) {
@@ -131,6 +131,13 @@ public:
     /// Sets the maximum number of connections the server permits.
     [[nodiscard]] server&& max_connections(size_t value) &&;
 
+    /// Configures the server to open `num_listeners` sockets for its port with
+    /// `SO_REUSEPORT`, each with its own acceptor. The OS then distributes
+    /// incoming connections to all sockets. When running multiple
+    /// multiplexers, the acceptors run on different multiplexers.
+    /// @note Has no effect when passing a socket to `accept`.
+    [[nodiscard]] server&& reuse_port(size_t num_listeners) &&;
+
     /// Monitors the actor handle @p hdl and stops the server if the monitored
     /// actor terminates.
     template <class ActorHandle>
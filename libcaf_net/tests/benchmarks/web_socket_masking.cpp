@@ -0,0 +1,77 @@
+// Measures the throughput of masking WebSocket payloads with
+// detail::rfc6455::mask_data and compares it to a loop that masks one byte at
+// a time.
+
+#include "caf/detail/rfc6455.hpp"
+
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/byte_buffer.hpp"
+#include "caf/caf_main.hpp"
+#include "caf/detail/network_order.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+
+using namespace caf;
+
+namespace {
+
+constexpr size_t default_iterations = 1'000;
+
+constexpr uint32_t mask_key = 0xDEADC0DE;
+
+struct config : actor_system_config {
+  config() {
+    opt_group{custom_options_, "global"} //
+      .add<size_t>("iterations,i", "number of masking runs per payload size");
+  }
+};
+
+/// The byte-wise implementation of `mask_data` that serves as baseline.
+void mask_bytewise(uint32_t key, byte_span data, size_t offset) {
+  auto no_key = detail::to_network_order(key);
+  std::byte arr[4];
+  memcpy(arr, &no_key, 4);
+  auto i = offset % 4;
+  for (auto it = data.begin() + offset; it < data.end(); ++it) {
+    *it ^= arr[i];
+    i = (i + 1) % 4;
+  }
+}
+
+template <class F>
+double run(F fn, byte_buffer& buf, size_t iterations) {
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < iterations; ++i)
+    fn(mask_key, buf, i % 4);
+  auto stop = std::chrono::steady_clock::now();
+  auto elapsed = std::chrono::duration<double>(stop - start).count();
+  auto total = static_cast<double>(buf.size() * iterations);
+  return total / elapsed / (1024.0 * 1024.0);
+}
+
+} // namespace
+
+int caf_main(actor_system& sys, const config& cfg) {
+  auto iterations = get_or(cfg, "iterations", default_iterations);
+  for (size_t size : {125u, 4'096u, 65'536u, 524'288u}) {
+    byte_buffer buf;
+    buf.resize(size);
+    for (size_t i = 0; i < size; ++i)
+      buf[i] = static_cast<std::byte>(i);
+    auto baseline = run(mask_bytewise, buf, iterations);
+    auto vectorized = run(
+      [](uint32_t key, byte_span data, size_t offset) {
+        detail::rfc6455::mask_data(key, data, offset);
+      },
+      buf, iterations);
+    sys.println("{:>7} bytes: {:>9.1f} MiB/s byte-wise, {:>9.1f} MiB/s "
+                "mask_data ({:.1f}x)",
+                size, baseline, vectorized, vectorized / baseline);
+  }
+  return EXIT_SUCCESS;
+}
+
+CAF_MAIN()